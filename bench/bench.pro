@@ -0,0 +1,90 @@
+######################################################################
+# Benchmark runner of the programs written by kevc_generator
+######################################################################
+
+TEMPLATE = app
+TARGET = bench
+DEPENDPATH += . ..
+INCLUDEPATH += . ..
+LIBS += -lgmpxx -lgmp -lrt -L/usr/lib/keves/keves/base/
+QMAKE_CXXFLAGS += -std=c++11
+
+# Input
+HEADERS += keves_builtin_values.hpp \
+           keves_common.hpp \
+           keves_common-inl.hpp \
+#           keves_eval_window.hpp \
+           keves_gc.hpp \
+#           keves_heap.hpp \
+           keves_iterator.hpp \
+           keves_library.hpp \
+           keves_list.hpp \
+           keves_log.hpp \
+           keves_profile.hpp \
+           keves_stack.hpp \
+           keves_template.hpp \
+           keves_textual_port.hpp \
+           keves_value.hpp \
+           keves_vm.hpp \
+           kev/bignum.hpp \
+           kev/code.hpp \
+           kev/condition.hpp \
+           kev/environment.hpp \
+           kev/generator.hpp \
+           kev/jump.hpp \
+           kev/frame.hpp \
+#           kev/library_kev.hpp \
+#           kev/macro.hpp \
+           kev/number.hpp \
+           kev/pair.hpp \
+           kev/procedure.hpp \
+           kev/record.hpp \
+           kev/reference.hpp \
+           kev/string.hpp \
+           kev/symbol.hpp \
+#           kev/template.hpp \
+           kev/vector.hpp \
+           kev/wind.hpp \
+           kev/wrapped.hpp \
+           value/char.hpp \
+           value/fixnum.hpp \
+           value/flonum.hpp \
+           value/instruct.hpp
+           
+
+SOURCES += main.cpp \
+           keves_builtin_values.cpp \
+           keves_common.cpp \
+           keves_gc.cpp \
+           keves_iterator.cpp \
+           keves_library.cpp \
+           keves_log.cpp \
+           keves_profile.cpp \
+           keves_stack.cpp \
+           keves_template.cpp \
+           keves_textual_port.cpp \
+           keves_vm.cpp \
+           kev/bignum.cpp \
+           kev/code.cpp \
+           kev/condition.cpp \
+           kev/environment.cpp \
+           kev/generator.cpp \
+           kev/jump.cpp \
+           kev/frame.cpp \
+           kev/number.cpp \
+           kev/pair.cpp \
+           kev/procedure.cpp \
+           kev/record.cpp \
+           kev/reference.cpp \
+           kev/string.cpp \
+           kev/symbol.cpp \
+           kev/vector.cpp \
+           kev/wind.cpp \
+           kev/wrapped.cpp \
+           value/char.cpp \
+           value/instruct.cpp
+
+# CONFIG += debug
+CONFIG += qt release
+# DEFINES += KEVES_TRACE
+# DEFINES += KEVES_LOG_MIN_LEVEL=KEVES_LOG_INFO
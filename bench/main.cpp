@@ -0,0 +1,299 @@
+// keves/bench/main.cpp - runner of the benchmark programs
+// Keves will be an R6RS Scheme implementation.
+//
+// Copyright (C) 2014  Yasuhiro Yamakawa <kawatab@yahoo.co.jp>
+//
+//  This program is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or any
+//  later version.
+// 
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+//  License for more details.
+// 
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <gmpxx.h>
+#include <sys/resource.h>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QStringList>
+#include <QThread>
+#include <QVector>
+#include "keves_common.hpp"
+#include "keves_gc.hpp"
+#include "keves_log.hpp"
+#include "keves_vm.hpp"
+
+
+// The programs are written to lib/bench/ by kevc_generator.
+//
+// usage: bench [--gc] [--stack=KB] [--nursery=KB] [iterations [name ...]]
+//
+// Each iteration runs the program in a new VM on a new thread, and the
+// results are written to the standard output as JSON. --gc selects the
+// microbenchmarks of GC instead of the classic programs. --stack sets
+// the stack size of the thread, where eden lives, and --nursery limits
+// the room of eden in it. allocation_rate counts the bytes allocated in
+// tenured, including the copies by GC, per second of wall time.
+// max_rss_kb is the peak of the whole process, so run one program at a
+// time to compare it.
+//
+// The result of every iteration is compared with the expected one as
+// written by KevesCommon::toString(). A program which fails or returns
+// another result is marked with "ok": false, and bench exits with 1.
+
+namespace {
+  struct Program {
+    const char* name;
+    const char* expected; // nullptr for factorial, made by GMP
+  };
+
+  const Program PROGRAMS[] = {
+    { "fib", "121393" },
+    { "fib-generic", "121393" },
+    { "tak", "7" },
+    { "ctak", "7" },
+    { "nqueens", "92" },
+    { "deriv",
+      "(+ (* (* 3 x x) (+ (/ 0 3) (/ 1 x) (/ 1 x)))"
+      " (* (* a x x) (+ (/ 0 a) (/ 1 x) (/ 1 x)))"
+      " (* (* b x) (+ (/ 0 b) (/ 1 x))) 0)" },
+    { "string-append", "6000" },
+    { "factorial", nullptr },
+    { "vector", "4999950000" },
+    { "assq", "5050000" }
+  };
+
+  const Program GC_PROGRAMS[] = {
+    { "gc-pair-churn", "1000000" },
+    { "gc-growing-list", "200000" },
+    { "gc-large-vectors", "999" },
+    { "gc-tenured-mutation", "(999 . 999)" },
+    { "gc-deep-recursion", "1000000" },
+    { "gc-closures", "5000050000" }
+  };
+
+  QString expectedResult(const QString& name) {
+    if (name == "factorial") {
+      mpz_class factorial;
+      mpz_fac_ui(factorial.get_mpz_t(), 1000);
+      return QString::fromStdString(factorial.get_str());
+    }
+
+    for (auto program : PROGRAMS)
+      if (name == program.name) return program.expected;
+
+    for (auto program : GC_PROGRAMS)
+      if (name == program.name) return program.expected;
+
+    return QString();
+  }
+
+  struct Config {
+    int iterations = 10;
+    unsigned stack_size = 0;
+    size_t nursery_size = 0;
+  };
+
+  struct Result {
+    bool ok = true;
+    double wall_time = 0.0;
+    double min_wall_time = 0.0;
+    double gc_time = 0.0;
+    long collections = 0;
+    unsigned long long allocated_bytes = 0;
+    unsigned long long promoted_bytes = 0;
+    QVector<double> pauses;
+  };
+
+  class BenchThread : public QThread {
+  public:
+    explicit BenchThread(KevesVM* vm) : vm_(vm), status_(-1) {}
+
+    int status() const {
+      return status_;
+    }
+
+  protected:
+    void run() {
+      status_ = vm_->execute();
+    }
+
+  private:
+    KevesVM* vm_;
+    int status_;
+  };
+
+  bool runProgram(KevesCommon* common, const QString& name,
+		  const Config& config, Result* result) {
+    QStringList id;
+    id << "bench" << name;
+
+    if (!QFile::exists(QString("lib/bench/%1.kevc").arg(name))) {
+      KEVES_LOG(KEVES_LOG_ERROR) << "bench: lib/bench/" << qPrintable(name)
+				 << ".kevc is not found";
+      return false;
+    }
+
+    QString expected(expectedResult(name));
+
+    for (int i(0); i < config.iterations; ++i) {
+      KevesVM* vm(KevesVM::make(common));
+      vm->set_main_library(id);
+      vm->set_nursery_size(config.nursery_size);
+      vm->gc()->set_pause_log(&result->pauses);
+      vm->acc_ = EMB_UNDEF;
+
+      BenchThread thread(vm);
+      if (config.stack_size > 0) thread.setStackSize(config.stack_size);
+
+      QElapsedTimer timer;
+      timer.start();
+      thread.start();
+      thread.wait();
+      double wall_time(timer.nsecsElapsed() / 1e9);
+
+      result->wall_time += wall_time;
+
+      if (i == 0 || wall_time < result->min_wall_time)
+	result->min_wall_time = wall_time;
+
+      result->gc_time += vm->gc()->getElapsedTime();
+      result->collections += vm->gc()->collections();
+      result->allocated_bytes += vm->gc()->allocated_bytes();
+      result->promoted_bytes += vm->gc()->promoted_bytes();
+
+      if (thread.status() != 0) {
+	KEVES_LOG(KEVES_LOG_ERROR) << "bench: " << qPrintable(name)
+				   << " failed with " << thread.status();
+	result->ok = false;
+      } else if (!expected.isNull()) {
+	QString actual(common->toString(vm->acc_));
+
+	if (actual != expected) {
+	  KEVES_LOG(KEVES_LOG_ERROR) << "bench: " << qPrintable(name)
+				     << " returned " << qPrintable(actual);
+	  result->ok = false;
+	}
+      }
+
+      delete vm;
+    }
+
+    std::sort(result->pauses.begin(), result->pauses.end());
+    return true;
+  }
+
+  double percentile(const QVector<double>& sorted, int percent) {
+    if (sorted.isEmpty()) return 0.0;
+    return sorted[(sorted.size() - 1) * percent / 100];
+  }
+
+  long maxRSS() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+  }
+
+  bool readOption(const char* arg, const char* name, unsigned long* value) {
+    std::size_t length(std::strlen(name));
+    if (std::strncmp(arg, name, length) != 0) return false;
+    *value = std::strtoul(arg + length, nullptr, 10);
+    return true;
+  }
+} // namespace
+
+
+int main(int argc, char* argv[]) {
+  Config config;
+  bool gc(false);
+  int i(1);
+
+  for (; i < argc && argv[i][0] == '-'; ++i) {
+    unsigned long value;
+
+    if (std::strcmp(argv[i], "--gc") == 0) {
+      gc = true;
+    } else if (readOption(argv[i], "--stack=", &value)) {
+      config.stack_size = value * 1024;
+    } else if (readOption(argv[i], "--nursery=", &value)) {
+      config.nursery_size = value * 1024;
+    } else {
+      std::cerr << "bench: unknown option " << argv[i] << "\n";
+      return 1;
+    }
+  }
+
+  if (i < argc) config.iterations = std::atoi(argv[i++]);
+
+  if (config.iterations <= 0) {
+    std::cerr << "usage: bench [--gc] [--stack=KB] [--nursery=KB]"
+	      << " [iterations [name ...]]\n";
+    return 1;
+  }
+
+  QStringList names;
+
+  for (; i < argc; ++i) names << argv[i];
+
+  if (names.isEmpty()) {
+    if (gc) {
+      for (auto program : GC_PROGRAMS) names << program.name;
+    } else {
+      for (auto program : PROGRAMS) names << program.name;
+    }
+  }
+
+  KevesCommon common;
+  bool first(true);
+  bool ok(true);
+
+  std::cout << "{\n  \"iterations\": " << config.iterations
+	    << ",\n  \"stack_kb\": " << config.stack_size / 1024
+	    << ",\n  \"nursery_kb\": " << config.nursery_size / 1024
+	    << ",\n  \"benchmarks\": [";
+
+  for (auto name : names) {
+    Result result;
+
+    if (!runProgram(&common, name, config, &result)) {
+      ok = false;
+      continue;
+    }
+
+    std::cout << (first ? "\n" : ",\n")
+	      << "    {\"name\": \"" << qPrintable(name) << "\""
+	      << ", \"ok\": " << (result.ok ? "true" : "false")
+	      << ", \"wall_time\": " << result.wall_time
+	      << ", \"min_wall_time\": " << result.min_wall_time
+	      << ", \"gc_time\": " << result.gc_time
+	      << ", \"collections\": " << result.collections
+	      << ", \"allocated_bytes\": " << result.allocated_bytes
+	      << ", \"allocation_rate\": "
+	      << (result.wall_time > 0.0
+		  ? result.allocated_bytes / result.wall_time : 0.0)
+	      << ", \"promoted_bytes\": " << result.promoted_bytes
+	      << ",\n     \"pauses\": {\"count\": " << result.pauses.size()
+	      << ", \"median\": " << percentile(result.pauses, 50)
+	      << ", \"p90\": " << percentile(result.pauses, 90)
+	      << ", \"p99\": " << percentile(result.pauses, 99)
+	      << ", \"max\": " << percentile(result.pauses, 100) << "}"
+	      << ", \"max_rss_kb\": " << maxRSS() << "}";
+
+    first = false;
+    if (!result.ok) ok = false;
+  }
+
+  std::cout << "\n  ]\n}\n";
+  KevesLog::flush();
+  return ok ? 0 : 1;
+}
@@ -237,9 +237,10 @@ bg_uint Bignum::toUInt(bool* ok) const {
 bg_ulong Bignum::toULong(bool* ok) const {
   const bg_uint* itr(begin());
 
-  return (*ok = len_ <= 2) ?
-    *itr + *(itr + 1) * (1ULL << 8 * sizeof(bg_uint)) :
-    0;
+  if (!(*ok = len_ <= 2)) return 0;
+
+  return len_ == 1 ?
+    *itr : *itr + *(itr + 1) * (1ULL << 8 * sizeof(bg_uint));
 }
 
 bool Bignum::isEven() const {
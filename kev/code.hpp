@@ -96,6 +96,9 @@ public:
   // Section For serialize !!!                              //
   ////////////////////////////////////////////////////////////
 
+  // Only the file is compact. readObject() expands code again to one
+  // KevesValue per word, so code in memory and its dispatch are the same
+  // as those of code made by kevc_generator.
 public:
   template<class BASE, class STACK>
   static void pushChildren(STACK* pending, KevesValue value) {
@@ -110,7 +113,7 @@ public:
     out << static_cast<uioword>(code->type())
 	<< static_cast<ioword>(code->size());
 
-    BASE::writeArray(list, out, code);
+    BASE::writeCode(list, out, code);
   }
 
   template<class BASE, class STREAM, class GC>
@@ -118,7 +121,7 @@ public:
     ioword size;
     in >> size;
     CodeKev* code(CodeKev::make(gc, size));
-    BASE::readArray(in, code);
+    BASE::readCode(in, code);
     return code;
   }
   
@@ -38,3 +38,17 @@ CompoundConditionKev* CompoundConditionKev::make(ZONE* zone, VectorKev* values)
 
   return zone->make(ctor, alloc_size(nullptr));
 }
+
+
+template<class ZONE>
+AssertConditionKev* AssertConditionKev::make(ZONE* zone,
+					     const RecordKev* kind,
+					     KevesValue who,
+					     KevesValue message,
+					     KevesValue irritants) {
+  auto ctor = [kind, who, message, irritants](void* ptr) {
+    return new(ptr) AssertConditionKev(kind, who, message, irritants);
+  };
+
+  return zone->make(ctor, alloc_size(nullptr));
+}
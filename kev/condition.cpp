@@ -60,3 +60,13 @@ void CompoundConditionKev::copyFrom(const CompoundConditionKev& other) {
 void CompoundConditionKev::copyFrom(CompoundConditionKev&& other) {
   this->values_ = other.values_;
 }
+
+
+// class AssertConditionKev ----------------------------------------
+AssertConditionKev::AssertConditionKev(const RecordKev* kind,
+				       KevesValue who,
+				       KevesValue message,
+				       KevesValue irritants)
+  : MutableKev(TYPE), kind_(kind), who_(who), message_(message),
+    irritants_(irritants) {
+}
@@ -203,3 +203,117 @@ public:
     IO::revertValue(object_list, &condition->values_);
   }
 };
+
+
+// A raised assertion or lexical violation, kept as one record until its
+// fields are looked up, instead of a compound of four simple conditions.
+class AssertConditionKev : public MutableKev {
+public:
+  static constexpr kev_type TYPE = CONDITION_AST;
+
+  AssertConditionKev() = delete;
+  AssertConditionKev(const AssertConditionKev&) = default;
+  AssertConditionKev(AssertConditionKev&&) = default;
+  AssertConditionKev& operator=(const AssertConditionKev&) = delete;
+  AssertConditionKev& operator=(AssertConditionKev&&) = delete;
+  ~AssertConditionKev() = default;
+
+  AssertConditionKev(const RecordKev* kind, KevesValue who,
+		     KevesValue message, KevesValue irritants);
+
+  KevesValue irritants() const {
+    return irritants_;
+  }
+
+  const RecordKev* kind() const {
+    return kind_;
+  }
+
+  KevesValue message() const {
+    return message_;
+  }
+
+  KevesValue who() const {
+    return who_;
+  }
+
+  template<class ZONE>
+  static AssertConditionKev* make(ZONE* zone, const RecordKev* kind,
+				  KevesValue who, KevesValue message,
+				  KevesValue irritants);
+
+private:
+  const RecordKev* kind_;
+  KevesValue who_;
+  KevesValue message_;
+  KevesValue irritants_;
+
+
+  ////////////////////////////////////////////////////////////
+  // Section For GC !!!                                     //
+  ////////////////////////////////////////////////////////////
+
+public:
+  static constexpr size_t alloc_size(const MutableKev*) {
+    return sizeof(AssertConditionKev);
+  }
+
+  template<class T>
+  static MutableKev* copyTo(T* zone, MutableKev* kev) {
+    return FixedLengthKev<AssertConditionKev>::from(kev)->copyTo(zone);
+  }
+
+  template<class T>
+  static quintptr* copyContents(T* zone, MutableKev* kev) {
+    FixedLengthKev<AssertConditionKev>* condition(FixedLengthKev<AssertConditionKev>::from(kev));
+    condition->who_ = zone->copy(condition->who_);
+    condition->message_ = zone->copy(condition->message_);
+    condition->irritants_ = zone->copy(condition->irritants_);
+    return condition->border();
+  }
+
+  ////////////////////////////////////////////////////////////
+  // Section For serialize !!!                              //
+  ////////////////////////////////////////////////////////////
+
+public:
+  template<class IO, class STACK>
+  static void pushChildren(STACK* pending, KevesValue value) {
+    const AssertConditionKev* condition(value);
+    IO::pushValue(pending, condition->kind_);
+    IO::pushValue(pending, condition->who_);
+    IO::pushValue(pending, condition->message_);
+    IO::pushValue(pending, condition->irritants_);
+  }
+
+  template<class IO, class LIST, class STREAM>
+  static void writeObject(const LIST& list, STREAM& out, KevesValue value) {
+    const AssertConditionKev* condition(value);
+
+    out << static_cast<uioword>(condition->type())
+	<< IO::indexAddress(list, condition->kind_)
+	<< IO::indexAddress(list, condition->who_)
+	<< IO::indexAddress(list, condition->message_)
+	<< IO::indexAddress(list, condition->irritants_);
+  }
+
+  template<class IO, class STREAM, class GC>
+  static Kev* readObject(STREAM& in, GC* gc) {
+    uioword kind, who, message, irritants;
+    in >> kind >> who >> message >> irritants;
+    return make(gc,
+		KevesValue::template fromUioword<RecordKev>(kind),
+		KevesValue::template fromUioword<Kev>(who),
+		KevesValue::template fromUioword<Kev>(message),
+		KevesValue::template fromUioword<Kev>(irritants));
+  }
+  
+  template<class IO, class LIST>
+  static void revertObject(const LIST& object_list, MutableKevesValue value) {
+    AssertConditionKev* condition(value);
+    IO::revertValue(object_list, &condition->kind_);
+    IO::revertValue(object_list, &condition->who_);
+    IO::revertValue(object_list, &condition->message_);
+    IO::revertValue(object_list, &condition->irritants_);
+  }
+};
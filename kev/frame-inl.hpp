@@ -42,6 +42,19 @@ LocalVarFrameKev* LocalVarFrameKev::make(ZONE* zone, int size, LocalVarFrameKev*
   return zone->make(ctor, alloc_size(size));
 }
 
+template<class ZONE>
+LocalVarFrameKev* LocalVarFrameKev::makeWithValues(ZONE* zone,
+						   int size,
+						   const KevesValue* values) {
+  auto ctor = [size, values](void* ptr) {
+    LocalVarFrameKev* env_frame(new(ptr) LocalVarFrameKev(size, nullptr));
+    std::copy(values, values + size, env_frame->array());
+    return env_frame;
+  };
+  
+  return zone->make(ctor, alloc_size(size));
+}
+
 /*
 template<class ZONE>
 FreeVarFrameKev* FreeVarFrameKev::make(ZONE* zone, int size, FreeVarFrameKev* next) {
@@ -20,6 +20,7 @@
 #include "kev/frame.hpp"
 #include "kev/frame-inl.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include "keves_gc.hpp"
 #include "value/fixnum.hpp"
@@ -73,8 +74,18 @@ void LocalVarFrameKev::copyArray(const LocalVarFrameKev* org) {
 
 
 // class StackFrameKev ----------------------------------------
-void StackFrameKev::setArgumentsToLocalVars() {
-  for (int i(1); i < argn_; ++i) envp_->array()[i - 1] = argp_->at(i);
+void StackFrameKev::moveLastArguments(int num, int base) {
+  Q_ASSERT(num >= 0 && num <= argn_ && base + num <= argp_->size());
+
+  KevesValue* first(argp_->array() + argn_ - num);
+  KevesValue* dest(argp_->array() + base);
+
+  if (dest < first)
+    std::copy(first, first + num, dest);
+  else if (dest > first)
+    std::copy_backward(first, first + num, dest + num);
+
+  argn_ = base + num;
 }
 
 void StackFrameKev::extendArgFrame(KevesGC* gc) {
@@ -100,6 +111,11 @@ void StackFrameKev::makeEnvFrame(KevesGC* gc, int frame_size) {
   envn_ = frame_size;
 }
 
+void StackFrameKev::makeEnvFrameWithArguments(KevesGC* gc) {
+  envn_ = argn_ - 1;
+  envp_ = LocalVarFrameKev::makeWithValues(gc, envn_, argp_->array() + 1);
+}
+
 void StackFrameKev::assignLastLocalVar(KevesValue kev, int offset) {
   assignLocalVar(envn_ - offset - 1, kev);
 }
@@ -227,6 +227,11 @@ public:
   template<class ZONE>
   static LocalVarFrameKev* make(ZONE* zone, int size, LocalVarFrameKev* next);
 
+  template<class ZONE>
+  static LocalVarFrameKev* makeWithValues(ZONE* zone,
+					  int size,
+					  const KevesValue* values);
+
 private:
   static size_t alloc_size(int size) {
     return sizeof(LocalVarFrameKev) + sizeof(KevesValue) * size;
@@ -343,7 +348,7 @@ public:
   StackFrameKev()
     : MutableKev(TYPE),
       fp_(), pc_(), argp_(), envp_(), clsr_(),
-      argn_(), envn_(), sfp_() {}
+      argn_(), envn_(), winders_(), escapes_(), sfp_() {}
   
   StackFrameKev(const StackFrameKev&) = default;
   StackFrameKev(StackFrameKev&&) = default;
@@ -392,6 +397,11 @@ public:
 
   // void copyEnvFrameTo(FreeVarFrameKev*) const;
 
+  // the innermost escape which is live in the extent of this frame
+  KevesValue escapes() const {
+    return escapes_;
+  }
+
   int envn() const {
     return envn_;
   }
@@ -430,11 +440,17 @@ public:
 
   KevesValue lastLocalVar(int index = 0) const;
 
+  // Move the last num arguments to index base and drop the others.
+  void moveLastArguments(int num, int base);
+
   template<class ZONE>
   static StackFrameKev* make(ZONE* zone);
 
   void makeEnvFrame(KevesGC* gc, int frame_size);
 
+  // make an env frame holding the arguments except the procedure
+  void makeEnvFrameWithArguments(KevesGC* gc);
+
   const_KevesIterator pc() const {
     return pc_;
   }
@@ -483,7 +499,13 @@ public:
     sfp_ = sfp;
   }
 
-  void setArgumentsToLocalVars();
+  void set_escapes(KevesValue escapes) {
+    escapes_ = escapes;
+  }
+
+  void set_winders(KevesValue winders) {
+    winders_ = winders;
+  }
 
   void setArgFrame(ArgumentFrameKev* frame, int n = 0) {
     argp_ = frame;
@@ -518,6 +540,12 @@ public:
   }
 
   void wind(const_KevesIterator, StackFrameKev*, ArgumentFrameKev*);
+
+  // the innermost dynamic wind whose extent this frame is in
+  KevesValue winders() const {
+    return winders_;
+  }
+
   void windWithExceptionHandler(const_KevesIterator, StackFrameKev*, ArgumentFrameKev*);
   void windWithValues(const_KevesIterator, StackFrameKev*, ArgumentFrameKev*);
 
@@ -541,6 +569,8 @@ protected:
   LocalVarFrameKev* clsr_;
   int argn_;
   int envn_;
+  KevesValue winders_;
+  KevesValue escapes_;
   StackFrameKev* sfp_;
 
   
@@ -572,6 +602,8 @@ public:
     frame->clsr_ = zone->copy(clsr);
     frame->fp_ = zone->copy(fp);
     frame->sfp_ = zone->copy(sfp);
+    frame->winders_ = zone->copy(frame->winders_);
+    frame->escapes_ = zone->copy(frame->escapes_);
 
     return frame->border();
   }
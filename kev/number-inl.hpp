@@ -32,6 +32,12 @@ FlonumKev* FlonumKev::make(ZONE* zone, double d) {
   return zone->make(ctor, alloc_size(nullptr));
 }
 
+template<class ZONE>
+KevesValue FlonumKev::makeValue(ZONE* zone, double d) {
+  if (KevesFlonum::isEncodable(d)) return KevesFlonum(d);
+  return make(zone, d);
+}
+
 template<class ZONE>
 ExactComplexNumberKev* ExactComplexNumberKev::make(ZONE* zone) {
   auto ctor = [](void* ptr) { return new(ptr) ExactComplexNumberKev(); };
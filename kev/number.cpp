@@ -20,9 +20,9 @@
 #include "kev/number.hpp"
 #include "kev/number-inl.hpp"
 
-#include <iostream>
 #include <sstream>
 #include "keves_gc.hpp"
+#include "keves_log.hpp"
 #include "kev/bignum.hpp"
 #include "kev/bignum-inl.hpp"
 #include "kev/string.hpp"
@@ -512,15 +512,15 @@ StringKev* NumberKev::makeStringFromDecimal(KevesGC* gc, KevesValue num, int pre
     try {
       str.operator=(num.toPtr<RationalNumberKev>()->toQString(false));
     } catch (int i) {
-      std::cout << "Allocation is failed!" << std::endl;
+      KEVES_LOG(KEVES_LOG_ERROR) << "Allocation is failed!";
     }
   } else if (num.is<FlonumKev>()) {
-    str.operator=(num.toPtr<FlonumKev>()->toQString(false, precision));
+    str.operator=(FlonumKev::fromKevesValue(num).toQString(false, precision));
   } else if (num.is<ExactComplexNumberKev>()) {
     try {
       str.operator=(num.toPtr<ExactComplexNumberKev>()->toQString());
     } catch (int i) {
-      std::cout << "Allocation is failed!" << std::endl;
+      KEVES_LOG(KEVES_LOG_ERROR) << "Allocation is failed!";
     }
   } else if (num.is<InexactComplexNumberKev>()) {
     str.operator=(num.toPtr<InexactComplexNumberKev>()->toQString(precision));
@@ -537,7 +537,7 @@ StringKev* NumberKev::makeStringFromBinary(KevesGC* gc, KevesValue num, int radi
   } else if (num.is<RationalNumberKev>()) {
     str.operator=(num.toPtr<RationalNumberKev>()->toBinary(false, radix));
   } else if (num.is<FlonumKev>()) {
-    RationalNumberKev exact(num.toPtr<FlonumKev>()->toExact(gc));
+    RationalNumberKev exact(FlonumKev::fromKevesValue(num).toExact(gc));
     str.operator=(exact.toBinary(false, radix));
   } else if (num.is<ExactComplexNumberKev>()) {
     str.operator=(num.toPtr<ExactComplexNumberKev>()->toBinary(radix));
@@ -576,17 +576,11 @@ KevesValue NumberKev::makeFromMPQ(KevesGC* gc, const mpq_class& mpq_num) {
   if (denominator == 1) {
     mpz_class numerator(mpq_num.get_num());
 
-    if (Bignum::calculateLength(numerator) == 1) {
-      bg_uint num(numerator.get_ui());
+    if (numerator.fits_slong_p()) {
+      long num(numerator.get_si());
       
-      if (sgn(mpq_num) < 0) {
-	if (num <= static_cast<bg_uint>(-KevesFixnum::MIN_VALUE))
-	  return KevesFixnum(-static_cast<fx_int>(num));
-	
-	if (num <= static_cast<bg_uint>(KevesFixnum::MAX_VALUE))
-	  return KevesFixnum(static_cast<fx_int>(num));
-
-      }
+      if (KevesFixnum::isInRange(num))
+	return KevesFixnum(static_cast<fx_int>(num));
     }
   }
 
@@ -641,10 +635,8 @@ FlonumKev NumberKev::makeFlonum(KevesValue x) {
     return rational->toInexact();
   }
 
-  if (x.is<FlonumKev>()) {
-    const FlonumKev* flonum(x);
-    return *flonum;
-  }
+  if (x.is<FlonumKev>())
+    return FlonumKev::fromKevesValue(x);
 
   return FlonumKev();
 }
@@ -723,7 +715,7 @@ KevesValue NumberKev::max(KevesGC* gc, KevesValue x, KevesValue y) {
     }
 
     if (x.is<RationalNumberKev>())
-      return max(gc, x, RationalNumberKev::makeFromInt(gc, num2));
+      return max(gc, x, RationalNumberKev::makeFromLong(gc, num2));
     
     if (x.is<FlonumKev>())
       return max(gc, x, FlonumKev(num2).copy(gc));
@@ -733,7 +725,7 @@ KevesValue NumberKev::max(KevesGC* gc, KevesValue x, KevesValue y) {
 
     if (x.isFixnum()) {
       KevesFixnum num1(x);
-      return max(gc, RationalNumberKev::makeFromInt(gc, num1), num2);
+      return max(gc, RationalNumberKev::makeFromLong(gc, num1), num2);
     }
 
     if (x.is<RationalNumberKev>()) {
@@ -745,21 +737,21 @@ KevesValue NumberKev::max(KevesGC* gc, KevesValue x, KevesValue y) {
       return max(gc, x, num2->toInexact().copy(gc));
     
   } else if (y.is<FlonumKev>()) {
-    const FlonumKev* num2(y);
+    const FlonumKev num2(FlonumKev::fromKevesValue(y));
 
     if (x.isFixnum()) {
       KevesFixnum num1(x);
-      return max(gc, FlonumKev(num1).copy(gc), num2);
+      return max(gc, FlonumKev(num1).copy(gc), y);
     }
 
     if (x.is<RationalNumberKev>()) {
       const RationalNumberKev* num1(x);
-      return max(gc, num1->toInexact().copy(gc), num2);
+      return max(gc, num1->toInexact().copy(gc), y);
     }
 
     if (x.is<FlonumKev>()) {
-      const FlonumKev* num1(x);
-      return num1->isGT(*num2) ? num1 :num2;
+      const FlonumKev num1(FlonumKev::fromKevesValue(x));
+      return num1.isGT(num2) ? x : y;
     }
 
   }
@@ -777,7 +769,7 @@ KevesValue NumberKev::min(KevesGC* gc, KevesValue x, KevesValue y) {
     }
 
     if (x.is<RationalNumberKev>())
-      return min(gc, x, RationalNumberKev::makeFromInt(gc, num2));
+      return min(gc, x, RationalNumberKev::makeFromLong(gc, num2));
 
     if (x.is<FlonumKev>())
       return min(gc, x, FlonumKev(num2).copy(gc));
@@ -787,7 +779,7 @@ KevesValue NumberKev::min(KevesGC* gc, KevesValue x, KevesValue y) {
 
     if (x.isFixnum()) {
       KevesFixnum num1(x);
-      return min(gc, RationalNumberKev::makeFromInt(gc, num1), num2);
+      return min(gc, RationalNumberKev::makeFromLong(gc, num1), num2);
     }
 
     if (x.is<RationalNumberKev>()) {
@@ -799,21 +791,21 @@ KevesValue NumberKev::min(KevesGC* gc, KevesValue x, KevesValue y) {
       return min(gc, x, num2->toInexact().copy(gc));
     
   } else if (y.is<FlonumKev>()) {
-    const FlonumKev* num2(y);
+    const FlonumKev num2(FlonumKev::fromKevesValue(y));
 
     if (x.isFixnum()) {
       KevesFixnum num1(x);
-      return min(gc, FlonumKev(num1).copy(gc), num2);
+      return min(gc, FlonumKev(num1).copy(gc), y);
     }
 
     if (x.is<RationalNumberKev>()) {
       const RationalNumberKev* num1(x);
-      return min(gc, num1->toInexact().copy(gc), num2);
+      return min(gc, num1->toInexact().copy(gc), y);
     }
 
     if (x.is<FlonumKev>()) {
-      const FlonumKev* num1(x);
-      return num1->isLT(*num2) ? num1 :num2;
+      const FlonumKev num1(FlonumKev::fromKevesValue(x));
+      return num1.isLT(num2) ? x : y;
     }
   }
 
@@ -852,11 +844,11 @@ void RationalNumberKev::copyFrom(RationalNumberKev&& other) {
   this->denominator_ = other.denominator_;
 }
 
-RationalNumberKev RationalNumberKev::fromInt(KevesGC* gc, fx_int n) {
-  bool neg;
-  if ((neg = n < 0)) n = -n;
+RationalNumberKev RationalNumberKev::fromInt(KevesGC* gc, bg_int n) {
+  bool neg(n < 0);
+  bg_uint abs_n(neg ? -static_cast<bg_uint>(n) : n);
 
-  return { neg, Bignum::makeFromInt(gc, n), Bignum::makeFromInt(gc, 1) };
+  return { neg, Bignum::makeFromInt(gc, abs_n), Bignum::makeFromInt(gc, 1) };
 }
 
 const Bignum* RationalNumberKev::numerator() const {
@@ -1146,15 +1138,15 @@ double RationalNumberKev::toDouble() const {
 KevesValue RationalNumberKev::toKevesFixnum() const {
   if (denominator_->isOne()) {
     bool ok;
-    bg_uint num(numerator_->toUInt(&ok));
+    bg_ulong num(numerator_->toULong(&ok));
 
     if (ok) {
       if (isNegative()) {
-	if (num <= static_cast<bg_uint>(-KevesFixnum::MIN_VALUE))
+	if (num <= static_cast<bg_ulong>(-static_cast<fx_long>(KevesFixnum::MIN_VALUE)))
 	  return KevesFixnum(-static_cast<fx_int>(num));
 	
       } else {
-	if (num <= static_cast<bg_uint>(KevesFixnum::MAX_VALUE))
+	if (num <= static_cast<bg_ulong>(KevesFixnum::MAX_VALUE))
 	  return KevesFixnum(static_cast<fx_int>(num));
 
       }
@@ -1286,7 +1278,8 @@ KevesValue RationalNumberKev::makeIntegerFromString(KevesGC* gc, bool negative,
 
 // class RationalNumberKevFromInt ----------------------------------------
 RationalNumberKevFromInt::RationalNumberKevFromInt(bg_int n)
-  : bignum_numerator_(n < 0 ? -n : n), bignum_denominator_(1) {
+  : bignum_numerator_(n < 0 ? -static_cast<bg_uint>(n) : n),
+    bignum_denominator_(1) {
   neg_ = n < 0;
   numerator_ = &bignum_numerator_;
   denominator_ = &bignum_denominator_;
@@ -1329,7 +1322,8 @@ RationalNumberKevFromInt::RationalNumberKevFromInt(bg_int numerator, bg_int deno
 }
 
 RationalNumberKevFromLong::RationalNumberKevFromLong(bg_long n)
-  : bignum_numerator_(n < 0 ? -n : n), bignum_denominator_(1) {
+  : bignum_numerator_(n < 0 ? -static_cast<bg_ulong>(n) : n),
+    bignum_denominator_(1) {
   neg_ = n < 0;
   numerator_ = &bignum_numerator_;
   denominator_ = &bignum_denominator_;
@@ -1840,12 +1834,17 @@ QString FlonumKev::toQString(bool sign, int precision) const {
 }
 
 KevesValue FlonumKev::toKevesFixnum() const {
+  // MAX_VALUE is not exact as a double on 64-bit targets.
   return (value_ >= KevesFixnum::MIN_VALUE &&
-	  value_ <= KevesFixnum::MAX_VALUE &&
+	  value_ < -static_cast<double>(KevesFixnum::MIN_VALUE) &&
 	  std::ceil(value_) == value_) ?
     KevesFixnum(value_) : KevesValue(EMB_UNDEF);
 }
 
+KevesValue FlonumKev::optimize() const {
+  return KevesFlonum::isEncodable(value_) ? KevesValue(KevesFlonum(value_)) : KevesValue(this);
+}
+
 RationalNumberKev FlonumKev::toExact(KevesGC* gc) const {
   Q_ASSERT(!isNaN() && !isInfinity() && !isZero());
 
@@ -2312,7 +2311,7 @@ KevesValue InexactComplexNumberKev::makeFromBinary(KevesGC* gc, StringKev str_re
 	      static_cast<double>(str_real.toInt(nullptr, radix)));
 
   if (str_imag.equals("0"))
-    return FlonumKev::make(gc, real);
+    return FlonumKev::makeValue(gc, real);
 
   double imag(static_cast<double>(str_imag.toInt(nullptr, radix)));
   
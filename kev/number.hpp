@@ -23,6 +23,7 @@
 #include <functional>
 #include "kev/bignum.hpp"
 #include "value/fixnum.hpp"
+#include "value/flonum.hpp"
 #include "kev/string.hpp"
 
 
@@ -137,7 +138,7 @@ public:
     return [zone, real](void* ptr) {
       return real < 0 ?
         new(ptr) RationalNumberKev(true,
-				   Bignum::makeFromInt(zone, -real),
+				   Bignum::makeFromInt(zone, -static_cast<bg_uint>(real)),
 				   Bignum::makeFromInt(zone, 1)) :
 	new(ptr) RationalNumberKev(false,
 				   Bignum::makeFromInt(zone, real),
@@ -150,7 +151,7 @@ public:
     return [zone, real](void* ptr) {
       return real < 0 ?
         new(ptr) RationalNumberKev(true,
-				   Bignum::makeFromLong(zone, -real),
+				   Bignum::makeFromLong(zone, -static_cast<bg_ulong>(real)),
 				   Bignum::makeFromLong(zone, 1)) :
 	new(ptr) RationalNumberKev(false,
 				   Bignum::makeFromLong(zone, real),
@@ -347,6 +348,7 @@ public:
   FlonumKev multiply(FlonumKev) const;
   InexactComplexNumberKev multiply(ExactComplexNumberKev) const;
   InexactComplexNumberKev multiply(InexactComplexNumberKev) const;
+  KevesValue optimize() const;
   FlonumKev reciprocal() const;
   FlonumKev round() const;
 
@@ -375,8 +377,27 @@ public:
   template<class ZONE>
   static FlonumKev* make(ZONE* zone, double);
 
+  // Embed the double when it fits, and box it in the zone otherwise, so
+  // that one value has only one representation.
+  template<class ZONE>
+  static KevesValue makeValue(ZONE* zone, double);
+
+  // Return the immediate form of a boxed flonum which fits in it.
+  static KevesValue canonicalize(KevesValue value) {
+    if (!value.isPtr() || value.type() != TYPE) return value;
+    double d(value.toPtr<FlonumKev>()->value_);
+    return KevesFlonum::isEncodable(d) ? KevesValue(KevesFlonum(d)) : value;
+  }
+
   static FlonumKev fromString(StringKev, bool*);
 
+  // Read both a KevesFlonum and a boxed FlonumKev.
+  static FlonumKev fromKevesValue(KevesValue value) {
+    return value.isFlonum() ?
+      FlonumKev(KevesFlonum(value)) :
+      FlonumKev(value.toPtr<FlonumKev>()->value_);
+  }
+
 private:
   static bool copyExponentPart(const QChar*, const QChar*, char*, int*);
 
@@ -848,6 +869,9 @@ namespace NumberKev {
       return NUMBER_KEV::func(num);
     }
 
+    if (x.isFlonum())
+      return NUMBER_KEV::func(FlonumKev::fromKevesValue(x));
+
     if (x.isPtr()) {
       switch (x.type()) {
       case RationalNumberKev::TYPE:
@@ -876,6 +900,9 @@ namespace NumberKev {
       return NUMBER_KEV::func(num);
     }
 
+    if (x.isFlonum())
+      return NUMBER_KEV::func(FlonumKev::fromKevesValue(x));
+
     if (x.isPtr()) {
       switch (x.type()) {
       case RationalNumberKev::TYPE: {
@@ -918,19 +945,16 @@ namespace NumberKev {
 	return NUMBER_KEV::func(num1, num2);
       }
       
-      if (x.isPtr()) {
-	if (x.type() == RationalNumberKev::TYPE) {
-	  const RationalNumberKev* num1(x);
-	  const RationalNumberKevFromInt rational(num2);
-	  return NUMBER_KEV::func(*num1, rational);
-	}
-	
-	if (x.type() == FlonumKev::TYPE) {
-	  const FlonumKev* num1(x);
-	  const FlonumKev flonum(num2);
-	  return NUMBER_KEV::func(*num1, flonum);
-	}
+      if (x.is<RationalNumberKev>()) {
+	const RationalNumberKev* num1(x);
+	const RationalNumberKevFromLong rational(num2);
+	return NUMBER_KEV::func(*num1, rational);
+      }
 	
+      if (x.is<FlonumKev>()) {
+	const FlonumKev num1(FlonumKev::fromKevesValue(x));
+	const FlonumKev flonum(num2);
+	return NUMBER_KEV::func(num1, flonum);
       }
       
       return NUMBER_KEV::func();
@@ -945,20 +969,17 @@ namespace NumberKev {
       
       if (x.isFixnum()) {
 	KevesFixnum num1(x);
-	return NUMBER_KEV::func(RationalNumberKevFromInt(num1), *num2);
+	return NUMBER_KEV::func(RationalNumberKevFromLong(num1), *num2);
       }
       
-      if (x.isPtr()) {
-	if (x.type() == RationalNumberKev::TYPE) {
-	  const RationalNumberKev* num1(x);
-	  return NUMBER_KEV::func(*num1, *num2);
-	}
+      if (x.is<RationalNumberKev>()) {
+	const RationalNumberKev* num1(x);
+	return NUMBER_KEV::func(*num1, *num2);
+      }
 	
-	if (x.type() == FlonumKev::TYPE) {
-	  const FlonumKev* num1(x);
-	  return NUMBER_KEV::func(*num1, num2->toInexact());
-	}
-
+      if (x.is<FlonumKev>()) {
+	const FlonumKev num1(FlonumKev::fromKevesValue(x));
+	return NUMBER_KEV::func(num1, num2->toInexact());
       }
       
       return NUMBER_KEV::func();
@@ -969,24 +990,22 @@ namespace NumberKev {
   
   template<class NUMBER_KEV> bool compare_helper2(KevesValue x, KevesValue y) {
     if (y.is<FlonumKev>()) {
-      const FlonumKev* num2(y);
+      const FlonumKev num2(FlonumKev::fromKevesValue(y));
       
       if (x.isFixnum()) {
 	KevesFixnum num1(x);
 	FlonumKev flonum(num1);
-	return NUMBER_KEV::func(flonum, *num2);
+	return NUMBER_KEV::func(flonum, num2);
       }
       
-      if (x.isPtr()) {
-	if (x.type() == RationalNumberKev::TYPE) {
-	  const RationalNumberKev* num1(x);
-	  return NUMBER_KEV::func(num1->toInexact(), *num2);
-	}
+      if (x.is<RationalNumberKev>()) {
+	const RationalNumberKev* num1(x);
+	return NUMBER_KEV::func(num1->toInexact(), num2);
+      }
 	
-	if (x.type() == FlonumKev::TYPE) {
-	  const FlonumKev* num1(x);
-	  return NUMBER_KEV::func(*num1, *num2);
-	}
+      if (x.is<FlonumKev>()) {
+	const FlonumKev num1(FlonumKev::fromKevesValue(x));
+	return NUMBER_KEV::func(num1, num2);
       }
     }
     
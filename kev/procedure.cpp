@@ -51,6 +51,44 @@ LambdaKev::LambdaKev(const LocalVarFrameKev* free_vars, CodeKev* code,
 
 
 
+// class EscapeKev ----------------------------------------
+EscapeKev::EscapeKev(StackFrameKev* fp, KevesValue outer)
+  : MutableKev(TYPE), fp_(fp), outer_(outer), depth_(depth(outer) + 1) {}
+
+int EscapeKev::depth(KevesValue escapes) {
+  if (!escapes.is<EscapeKev>())
+    return 0;
+
+  const EscapeKev* escape(escapes);
+  return escape->depth();
+}
+
+KevesValue EscapeKev::commonAncestor(KevesValue escapes1, KevesValue escapes2) {
+  int depth1(depth(escapes1));
+  int depth2(depth(escapes2));
+
+  for (; depth1 > depth2; --depth1) {
+    const EscapeKev* escape(escapes1);
+    escapes1 = escape->outer();
+  }
+
+  for (; depth2 > depth1; --depth2) {
+    const EscapeKev* escape(escapes2);
+    escapes2 = escape->outer();
+  }
+
+  for (; depth1 > 0 && escapes1 != escapes2; --depth1) {
+    const EscapeKev* escape1(escapes1);
+    const EscapeKev* escape2(escapes2);
+    escapes1 = escape1->outer();
+    escapes2 = escape2->outer();
+  }
+
+  return escapes1;
+}
+
+
+
 // class ContinuationKev ----------------------------------------
 ContinuationKev::ContinuationKev(StackFrameKev registers)
   : MutableKev(TYPE), registers_(registers) {}
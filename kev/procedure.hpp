@@ -19,7 +19,7 @@
 
 #pragma once
 
-#include <iostream>
+#include "keves_log.hpp"
 #include "kev/code.hpp"
 #include "kev/frame.hpp"
 
@@ -89,26 +89,26 @@ public:
 
   template<class /*BASE*/, class STACK>
   static void pushChildren(STACK* /*pending*/, KevesValue /*value*/) {
-    std::cerr << "Cannot write ContinuationKev\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot write CPSKev";
   }
 
   template<class /*BASE*/, class LIST, class STREAM>
   static void writeObject(const LIST& /*list*/,
 			  STREAM& /*out*/,
 			  KevesValue /*value*/) {
-    std::cerr << "Cannot write ContinuationKev\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot write CPSKev";
   }
 
   template<class /*BASE*/, class STREAM, class GC>
   static Kev* readObject(STREAM& /*in*/, GC* /*gc*/) {
-    std::cerr << "Cannot read ContinuationKev\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot read CPSKev";
     return nullptr;
   }
   
   template<class /*BASE*/, class LIST>
   static void revertObject(const LIST& /*object_list*/,
 			   MutableKevesValue /*kev*/) {
-    std::cerr << "Cannot read ContinuationKev\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot read CPSKev";
   }
 };
 
@@ -281,25 +281,127 @@ private:
 
   template<class /*BASE*/, class STACK>
   static void pushChildren(STACK* /*pending*/, KevesValue /*value*/) {
-    std::cerr << "Cannot write ContinuationKev\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot write ContinuationKev";
   }
 
   template<class /*BASE*/, class LIST, class STREAM>
   static void writeObject(const LIST& /*list*/,
 			  STREAM& /*out*/,
 			  KevesValue /*value*/) {
-    std::cerr << "Cannot write ContinuationKev\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot write ContinuationKev";
   }
 
   template<class /*BASE*/, class STREAM, class GC>
   static Kev* readObject(STREAM& /*in*/, GC* /*gc*/) {
-    std::cerr << "Cannot read ContinuationKev\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot read ContinuationKev";
     return nullptr;
   }
   
   template<class /*BASE*/, class LIST>
   static void revertObject(const LIST& /*object_list*/,
 			   MutableKevesValue /*kev*/) {
-    std::cerr << "Cannot read ContinuationKev\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot read ContinuationKev";
+  }
+};
+
+// An escape-only continuation made by call/ec. It keeps only the frame
+// returning to the caller of call/ec, and expires when the receiver returns
+// or the escape is taken.
+class EscapeKev : public MutableKev {
+public:
+  static constexpr kev_type TYPE = ESCAPE;
+
+  EscapeKev() = delete;
+  EscapeKev(const EscapeKev&) = default;
+  EscapeKev(EscapeKev&&) = default;
+  EscapeKev& operator=(const EscapeKev&) = delete;
+  EscapeKev& operator=(EscapeKev&&) = delete;
+  ~EscapeKev() = default;
+
+  // *outer* is the innermost escape which is live in the frame
+  EscapeKev(StackFrameKev* fp, KevesValue outer);
+
+  void expire() {
+    fp_ = nullptr;
+  }
+
+  // the number of escapes in the list from this one
+  int depth() const {
+    return depth_;
+  }
+
+  const StackFrameKev* fp() const {
+    return fp_;
+  }
+
+  bool isExpired() const {
+    return !fp_;
+  }
+
+  // the escape taken just before this one in the extent of its frame
+  KevesValue outer() const {
+    return outer_;
+  }
+
+  // the innermost escape shared by both lists
+  static KevesValue commonAncestor(KevesValue escapes1, KevesValue escapes2);
+
+  static int depth(KevesValue escapes);
+
+private:
+  StackFrameKev* fp_;
+  KevesValue outer_;
+  int depth_;
+
+
+  ////////////////////////////////////////////////////////////
+  // Section For GC !!!                                     //
+  ////////////////////////////////////////////////////////////
+
+public:
+  static constexpr size_t alloc_size(const MutableKev*) {
+    return sizeof(EscapeKev);
+  }
+
+  template<class ZONE>
+  static MutableKev* copyTo(ZONE* zone, MutableKev* kev) {
+    return FixedLengthKev<EscapeKev>::from(kev)->copyTo(zone);
+  }
+
+  template<class ZONE>
+  static quintptr* copyContents(ZONE* zone, MutableKev* kev) {
+    FixedLengthKev<EscapeKev>* escape(FixedLengthKev<EscapeKev>::from(kev));
+    FixedLengthKev<StackFrameKev>* fp(FixedLengthKev<StackFrameKev>::from(escape->fp_));
+    escape->fp_ = zone->copy(fp);
+    escape->outer_ = zone->copy(escape->outer_);
+    return escape->border();
+  }
+
+  ////////////////////////////////////////////////////////////
+  // Section For serialize !!!                              //
+  ////////////////////////////////////////////////////////////
+
+  template<class /*BASE*/, class STACK>
+  static void pushChildren(STACK* /*pending*/, KevesValue /*value*/) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot write EscapeKev";
+  }
+
+  template<class /*BASE*/, class LIST, class STREAM>
+  static void writeObject(const LIST& /*list*/,
+			  STREAM& /*out*/,
+			  KevesValue /*value*/) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot write EscapeKev";
+  }
+
+  template<class /*BASE*/, class STREAM, class GC>
+  static Kev* readObject(STREAM& /*in*/, GC* /*gc*/) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot read EscapeKev";
+    return nullptr;
+  }
+  
+  template<class /*BASE*/, class LIST>
+  static void revertObject(const LIST& /*object_list*/,
+			   MutableKevesValue /*kev*/) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Cannot read EscapeKev";
   }
 };
@@ -19,8 +19,8 @@
 
 #pragma once
 
-#include <iostream>
 #include <QString>
+#include "keves_log.hpp"
 #include "keves_value.hpp"
 
 
@@ -75,26 +75,26 @@ public:
 public:
   template<class IO, class STACK>
   static void pushChildren(STACK* /*pending*/, KevesValue /*value*/) {
-    std::cerr << "RecordKev cannot be serialize!!!\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "RecordKev cannot be serialize!!!";
     Q_ASSERT(0);
   }
 
   template<class IO, class LIST, class STREAM>
   static void writeObject(const LIST& /*list*/, STREAM& /*out*/, KevesValue /*value*/) {
-    std::cerr << "RecordKev cannot be serialize!!!\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "RecordKev cannot be serialize!!!";
     Q_ASSERT(0);
   }
 
   template<class IO, class STREAM, class GC>
   static Kev* readObject(STREAM& /*in*/, GC* /*gc*/) {
-    std::cerr << "RecordKev cannot be serialize!!!\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "RecordKev cannot be serialize!!!";
     Q_ASSERT(0);
     return nullptr;
   }
   
   template<class IO, class LIST>
   static void revertObject(const LIST& /*object_list*/, MutableKevesValue /*value*/) {
-    std::cerr << "RecordKev cannot be serialize!!!\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "RecordKev cannot be serialize!!!";
     Q_ASSERT(0);
   }
 };
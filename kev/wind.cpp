@@ -21,4 +21,41 @@
 
 
 WindKev::WindKev(KevesValue before, KevesValue thunk, KevesValue after)
-  : MutableKev(TYPE), before_(before), thunk_(thunk), after_(after) {}
+  : WindKev(before, thunk, after, KevesValue(), nullptr) {}
+
+WindKev::WindKev(KevesValue before, KevesValue thunk, KevesValue after,
+		 KevesValue outer, StackFrameKev* fp)
+  : MutableKev(TYPE), before_(before), thunk_(thunk), after_(after),
+    outer_(outer), fp_(fp), depth_(depth(outer) + 1) {}
+
+int WindKev::depth(KevesValue winders) {
+  if (!winders.is<WindKev>())
+    return 0;
+
+  const WindKev* wind(winders);
+  return wind->depth();
+}
+
+KevesValue WindKev::commonAncestor(KevesValue winders1, KevesValue winders2) {
+  int depth1(depth(winders1));
+  int depth2(depth(winders2));
+
+  for (; depth1 > depth2; --depth1) {
+    const WindKev* wind(winders1);
+    winders1 = wind->outer();
+  }
+
+  for (; depth2 > depth1; --depth2) {
+    const WindKev* wind(winders2);
+    winders2 = wind->outer();
+  }
+
+  for (; depth1 > 0 && winders1 != winders2; --depth1) {
+    const WindKev* wind1(winders1);
+    const WindKev* wind2(winders2);
+    winders1 = wind1->outer();
+    winders2 = wind2->outer();
+  }
+
+  return winders1;
+}
@@ -20,6 +20,7 @@
 #pragma once
 
 #include "keves_value.hpp"
+#include "kev/frame.hpp"
 
 
 class WindKev : public MutableKev {
@@ -34,6 +35,9 @@ public:
   ~WindKev() = default;
 
   WindKev(KevesValue before, KevesValue thunk, KevesValue after);
+
+  WindKev(KevesValue before, KevesValue thunk, KevesValue after,
+	  KevesValue outer, StackFrameKev* fp);
   
   KevesValue before() const {
     return before_;
@@ -47,6 +51,26 @@ public:
     return after_;
   }
 
+  // the number of dynamic winds in the list from this one
+  int depth() const {
+    return depth_;
+  }
+
+  // the frame which called dynamic-wind
+  const StackFrameKev* fp() const {
+    return fp_;
+  }
+
+  // the dynamic wind just outside this one
+  KevesValue outer() const {
+    return outer_;
+  }
+
+  // the innermost dynamic wind shared by both lists
+  static KevesValue commonAncestor(KevesValue winders1, KevesValue winders2);
+
+  static int depth(KevesValue winders);
+
   template<class ZONE>
   static WindKev* make(ZONE* zone, KevesValue before, KevesValue thunk,
 		       KevesValue after);
@@ -55,6 +79,9 @@ private:
   KevesValue before_;
   KevesValue thunk_;
   KevesValue after_;
+  KevesValue outer_;
+  StackFrameKev* fp_;
+  int depth_;
 
   
   ////////////////////////////////////////////////////////////
@@ -77,6 +104,9 @@ public:
     wind->before_ = zone->copy(wind->before_);
     wind->thunk_ = zone->copy(wind->thunk_);
     wind->after_ = zone->copy(wind->after_);
+    wind->outer_ = zone->copy(wind->outer_);
+    FixedLengthKev<StackFrameKev>* fp(FixedLengthKev<StackFrameKev>::from(wind->fp_));
+    wind->fp_ = zone->copy(fp);
     return wind->border();
   }
 
@@ -84,6 +114,8 @@ public:
   // Section For serialize !!!                              //
   ////////////////////////////////////////////////////////////
 
+  // The list of outer winds is kept, but not the frame, which is only on
+  // the stack of a running VM; a wind read back is not in any frame.
 public:
   template<class BASE, class STACK>
   static void pushChildren(STACK* pending, KevesValue value) {
@@ -91,6 +123,7 @@ public:
     BASE::pushValue(pending, wind->before_);
     BASE::pushValue(pending, wind->thunk_);
     BASE::pushValue(pending, wind->after_);
+    BASE::pushValue(pending, wind->outer_);
   }
 
   template<class BASE, class LIST, class STREAM>
@@ -100,17 +133,24 @@ public:
     out << static_cast<uioword>(wind->type())
 	<< BASE::indexAddress(list, wind->before_)
 	<< BASE::indexAddress(list, wind->thunk_)
-	<< BASE::indexAddress(list, wind->after_);
+	<< BASE::indexAddress(list, wind->after_)
+	<< BASE::indexAddress(list, wind->outer_)
+	<< static_cast<ioword>(wind->depth_);
   }
 
   template<class /*BASE*/, class STREAM, class GC>
   static Kev* readObject(STREAM& in, GC* gc) {
-    uioword before, thunk, after;
-    in >> before >> thunk >> after;
-    return make(gc,
-		KevesValue::template fromUioword<Kev>(before),
-		KevesValue::template fromUioword<Kev>(thunk),
-		KevesValue::template fromUioword<Kev>(after));
+    uioword before, thunk, after, outer;
+    ioword depth;
+    in >> before >> thunk >> after >> outer >> depth;
+    WindKev* wind(make(gc,
+		       KevesValue::template fromUioword<Kev>(before),
+		       KevesValue::template fromUioword<Kev>(thunk),
+		       KevesValue::template fromUioword<Kev>(after)));
+    wind->outer_ = KevesValue::template fromUioword<Kev>(outer);
+    wind->fp_ = nullptr;
+    wind->depth_ = depth;
+    return wind;
   }
   
   template<class BASE, class LIST>
@@ -119,5 +159,6 @@ public:
     BASE::revertValue(object_list, &wind->before_);
     BASE::revertValue(object_list, &wind->thunk_);
     BASE::revertValue(object_list, &wind->after_);
+    BASE::revertValue(object_list, &wind->outer_);
   }
 };
@@ -0,0 +1,1961 @@
+// keves/kevc_generator/bench_code.cpp - benchmark programs for kevc_generator
+// Keves will be an R6RS Scheme implementation.
+//
+// Copyright (C) 2014  Yasuhiro Yamakawa <kawatab@yahoo.co.jp>
+//
+//  This program is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or any
+//  later version.
+// 
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+//  License for more details.
+// 
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "bench_code.hpp"
+
+#include "kevc_generator.hpp"
+#include "kev/code.hpp"
+#include "kev/environment.hpp"
+#include "kev/frame.hpp"
+#include "kev/pair.hpp"
+#include "kev/procedure.hpp"
+#include "kev/string.hpp"
+#include "kev/symbol.hpp"
+#include "value/fixnum.hpp"
+#include "value/instruct.hpp"
+
+
+// Each program is written as the library (bench <name>), which exports
+// my-code and environment like (keves base), so that the bench runner
+// can execute it in place of the REPL.
+
+// (define (fib n)
+//   (if (< n 2)
+//       1
+//       (+ (fib (- n 2)) (fib (- n 1)))))
+// (fib 25)
+void BenchCode::Fib::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_sub(generator->importBind("-"));
+  KevesValue proc_lt(generator->importBind("<"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_fib(generator->makeCode(31));
+  LambdaKev* proc_fib(generator->makeLambda(clsr, code_fib, 0));
+
+  {
+    KevesIterator iter(code_fib->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(2); // else --->
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- else
+    *iter++ = KevesFixnum(7); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_fib;
+    *iter++ = KevesInstruct(CMD_SUB_FX_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- return1
+    *iter++ = KevesFixnum(7); // return2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_fib;
+    *iter++ = KevesInstruct(CMD_SUB_FX_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_ADD_FX); // <--- return2
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_fib->end());
+  }
+
+  CodeKev* code(generator->makeCode(8));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_fib;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(25);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// The same fib as above, compiled without the fixnum instructions: each
+// of <, - and + is a generic procedure call. Comparing this with fib
+// measures what LT_FX_LOCAL_R, SUB_FX_LOCAL and ADD_FX save.
+void BenchCode::FibGeneric::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_sub(generator->importBind("-"));
+  KevesValue proc_lt(generator->importBind("<"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_fib(generator->makeCode(49));
+  LambdaKev* proc_fib(generator->makeLambda(clsr, code_fib, 0));
+
+  {
+    KevesIterator iter(code_fib->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // test --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R); // <--- test
+    *iter++ = KevesFixnum(2); // else --->
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- else
+    *iter++ = KevesFixnum(31); // return3 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(12); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_fib;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // sub1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA); // <--- sub1
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- return1
+    *iter++ = KevesFixnum(12); // return2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_fib;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // sub2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA); // <--- sub2
+    *iter++ = KevesInstruct(CMD_APPLY); // <--- return2
+    *iter++ = KevesInstruct(CMD_RETURN); // <--- return3
+    Q_ASSERT(iter <= code_fib->end());
+  }
+
+  CodeKev* code(generator->makeCode(8));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_fib;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(25);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (define (tak x y z)
+//   (if (not (< y x))
+//       z
+//       (tak (tak (- x 1) y z)
+//            (tak (- y 1) z x)
+//            (tak (- z 1) x y))))
+// (tak 18 12 6)
+void BenchCode::Tak::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_sub(generator->importBind("-"));
+  KevesValue proc_lt(generator->importBind("<"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_tak(generator->makeCode(55));
+  LambdaKev* proc_tak(generator->makeLambda(clsr, code_tak, 0));
+
+  {
+    KevesIterator iter(code_tak->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_R);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(42); // else --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(11); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_tak;
+    *iter++ = KevesInstruct(CMD_SUB_FX_LOCAL);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- return1
+    *iter++ = KevesFixnum(11); // return2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_tak;
+    *iter++ = KevesInstruct(CMD_SUB_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- return2
+    *iter++ = KevesFixnum(11); // return3 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_tak;
+    *iter++ = KevesInstruct(CMD_SUB_FX_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA); // <--- return3
+    *iter++ = proc_tak;
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- else
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_tak->end());
+  }
+
+  CodeKev* code(generator->makeCode(12));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_tak;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(18);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(12);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(6);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (define (ctak x y z)
+//   (call/cc (lambda (k) (ctak-aux k x y z))))
+// (define (ctak-aux k x y z)
+//   (if (not (< y x))
+//       (k z)
+//       (call/cc
+//        (lambda (k)
+//          (ctak-aux k
+//                    (call/cc (lambda (k) (ctak-aux k (- x 1) y z)))
+//                    (call/cc (lambda (k) (ctak-aux k (- y 1) z x)))
+//                    (call/cc (lambda (k) (ctak-aux k (- z 1) x y))))))))
+// (ctak 18 12 6)
+void BenchCode::Ctak::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_sub(generator->importBind("-"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_call_cc(generator->importBind("call/cc"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_ctak(generator->makeCode(21));
+  LambdaKev* proc_ctak(generator->makeLambda(clsr, code_ctak, 0));
+  CodeKev* code_ctak_aux(generator->makeCode(104));
+  LambdaKev* proc_ctak_aux(generator->makeLambda(clsr, code_ctak_aux, 0));
+
+  {
+    KevesIterator iter(code_ctak->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_CLOSE_R);
+    *iter++ = KevesFixnum(12); // close --->
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_ctak_aux;
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT); // <--- close
+    *iter++ = proc_call_cc;
+    *iter++ = KevesFixnum(1);
+    Q_ASSERT(iter <= code_ctak->end());
+  }
+
+  {
+    KevesIterator iter(code_ctak_aux->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_R);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(88); // else --->
+    *iter++ = KevesInstruct(CMD_CLOSE_R);
+    *iter++ = KevesFixnum(81); // close --->
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(23); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_call_cc;
+    *iter++ = KevesInstruct(CMD_CLOSE_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_SUB_FX);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_ctak_aux;
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- return1
+    *iter++ = KevesFixnum(23); // return2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_call_cc;
+    *iter++ = KevesInstruct(CMD_CLOSE_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_SUB_FX);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_ctak_aux;
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- return2
+    *iter++ = KevesFixnum(23); // return3 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_call_cc;
+    *iter++ = KevesInstruct(CMD_CLOSE_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_SUB_FX);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_ctak_aux;
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA); // <--- return3
+    *iter++ = proc_ctak_aux;
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT); // <--- close
+    *iter++ = proc_call_cc;
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- else
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
+    Q_ASSERT(iter <= code_ctak_aux->end());
+  }
+
+  CodeKev* code(generator->makeCode(12));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_ctak;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(18);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(12);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(6);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (define (iota1 i l)
+//   (if (= i 0) l (iota1 (- i 1) (cons i l))))
+// (define (queens n)
+//   (try (iota1 n '()) '() '()))
+// (define (try x y z)
+//   (if (pair? x)
+//       (+ (if (ok? (car x) 1 z)
+//              (try (append (cdr x) y) '() (cons (car x) z))
+//              0)
+//          (try (cdr x) (cons (car x) y) z))
+//       (if (pair? y) 0 1)))
+// (define (ok? row dist placed)
+//   (if (pair? placed)
+//       (and (not (= (car placed) (+ row dist)))
+//            (not (= (car placed) (- row dist)))
+//            (ok? row (+ dist 1) (cdr placed)))
+//       #t))
+// (queens 8)
+void BenchCode::Nqueens::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_sub(generator->importBind("-"));
+  KevesValue proc_num_eq(generator->importBind("="));
+  KevesValue proc_cons(generator->importBind("cons"));
+  KevesValue proc_append(generator->importBind("append"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_iota1(generator->makeCode(27));
+  LambdaKev* proc_iota1(generator->makeLambda(clsr, code_iota1, 0));
+  CodeKev* code_try(generator->makeCode(85));
+  LambdaKev* proc_try(generator->makeLambda(clsr, code_try, 0));
+  CodeKev* code_ok_q(generator->makeCode(51));
+  LambdaKev* proc_ok_q(generator->makeLambda(clsr, code_ok_q, 0));
+  CodeKev* code_queens(generator->makeCode(18));
+  LambdaKev* proc_queens(generator->makeLambda(clsr, code_queens, 0));
+
+  {
+    KevesIterator iter(code_iota1->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(0);
+    *iter++ = proc_num_eq;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(3); // else --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    *iter++ = KevesInstruct(CMD_SUB_FX_LOCAL); // <--- else
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA); // <--- return
+    *iter++ = proc_iota1;
+    *iter++ = KevesFixnum(2);
+    Q_ASSERT(iter <= code_iota1->end());
+  }
+
+  {
+    KevesIterator iter(code_try->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_TEST_PAIR_R);
+    *iter++ = KevesFixnum(71); // null_x --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_ok_q;
+    *iter++ = KevesInstruct(CMD_CAR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R); // <--- return1
+    *iter++ = KevesFixnum(31); // not_ok --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(27); // return2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_try;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_append;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_CDR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = EMB_NULL;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_CAR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_JUMP_R); // <--- return2
+    *iter++ = KevesFixnum(2); // next --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT); // <--- not_ok
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- next
+    *iter++ = KevesFixnum(20); // return5 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_try;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_CDR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_CAR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_ADD_FX); // <--- return5
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_RETURN);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- null_x
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_TEST_PAIR_R);
+    *iter++ = KevesFixnum(2); // null_y --->
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT); // <--- null_y
+    *iter++ = KevesFixnum(1);
+    Q_ASSERT(iter <= code_try->end());
+  }
+
+  {
+    KevesIterator iter(code_ok_q->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_TEST_PAIR_R);
+    *iter++ = KevesFixnum(43); // null --->
+    *iter++ = KevesInstruct(CMD_CAR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_ADD_FX);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_R);
+    *iter++ = proc_num_eq;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(2); // next1 --->
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT);
+    *iter++ = EMB_FALSE;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- next1
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CAR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_SUB_FX);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_R);
+    *iter++ = proc_num_eq;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(2); // next2 --->
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT);
+    *iter++ = EMB_FALSE;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- next2
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CDR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_ok_q;
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT); // <--- null
+    *iter++ = EMB_TRUE;
+    Q_ASSERT(iter <= code_ok_q->end());
+  }
+
+  {
+    KevesIterator iter(code_queens->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_iota1;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = EMB_NULL;
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT); // <--- return
+    *iter++ = EMB_NULL;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = EMB_NULL;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_try;
+    *iter++ = KevesFixnum(3);
+    Q_ASSERT(iter <= code_queens->end());
+  }
+
+  CodeKev* code(generator->makeCode(8));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_queens;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(8);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (define (deriv a)
+//   (cond ((not (pair? a)) (if (eq? a 'x) 1 0))
+//         ((eq? (car a) '+) (cons '+ (map deriv (cdr a))))
+//         ((eq? (car a) '-) (cons '- (map deriv (cdr a))))
+//         ((eq? (car a) '*)
+//          (list '* a (cons '+ (map (lambda (a) (list '/ (deriv a) a))
+//                                   (cdr a)))))
+//         (else 0)))
+// (let loop ((i 0))
+//   (if (< i 10000)
+//       (begin (deriv '(+ (* 3 x x) (* a x x) (* b x) 5))
+//              (loop (+ i 1)))
+//       (deriv '(+ (* 3 x x) (* a x x) (* b x) 5))))
+void BenchCode::Deriv::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_cons(generator->importBind("cons"));
+  KevesValue proc_list(generator->importBind("list"));
+  KevesValue proc_map(generator->importBind("map"));
+
+  SymbolKev* sym_a(generator->makeSymbol("a"));
+  SymbolKev* sym_add(generator->makeSymbol("+"));
+  SymbolKev* sym_b(generator->makeSymbol("b"));
+  SymbolKev* sym_div(generator->makeSymbol("/"));
+  SymbolKev* sym_mul(generator->makeSymbol("*"));
+  SymbolKev* sym_sub(generator->makeSymbol("-"));
+  SymbolKev* sym_x(generator->makeSymbol("x"));
+
+  // (* 3 x x), (* a x x) and (* b x)
+  PairKev* term_3xx(generator->makePair(sym_x, EMB_NULL));
+  term_3xx = generator->makePair(sym_x, term_3xx);
+  term_3xx = generator->makePair(KevesFixnum(3), term_3xx);
+  term_3xx = generator->makePair(sym_mul, term_3xx);
+  PairKev* term_axx(generator->makePair(sym_x, EMB_NULL));
+  term_axx = generator->makePair(sym_x, term_axx);
+  term_axx = generator->makePair(sym_a, term_axx);
+  term_axx = generator->makePair(sym_mul, term_axx);
+  PairKev* term_bx(generator->makePair(sym_x, EMB_NULL));
+  term_bx = generator->makePair(sym_b, term_bx);
+  term_bx = generator->makePair(sym_mul, term_bx);
+
+  // (+ (* 3 x x) (* a x x) (* b x) 5)
+  PairKev* expression(generator->makePair(KevesFixnum(5), EMB_NULL));
+  expression = generator->makePair(term_bx, expression);
+  expression = generator->makePair(term_axx, expression);
+  expression = generator->makePair(term_3xx, expression);
+  expression = generator->makePair(sym_add, expression);
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_deriv(generator->makeCode(91));
+  LambdaKev* proc_deriv(generator->makeLambda(clsr, code_deriv, 0));
+  CodeKev* code_deriv_term(generator->makeCode(16));
+  LambdaKev* proc_deriv_term(generator->makeLambda(clsr, code_deriv_term, 0));
+  CodeKev* code_loop(generator->makeCode(28));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+
+  {
+    KevesIterator iter(code_deriv->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_TEST_PAIR_R);
+    *iter++ = KevesFixnum(76); // atom --->
+    *iter++ = KevesInstruct(CMD_CAR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_CONSTANT);
+    *iter++ = sym_add;
+    *iter++ = KevesInstruct(CMD_TEST_QEV_EQUAL_R);
+    *iter++ = KevesFixnum(17); // not_add --->
+    *iter++ = KevesInstruct(CMD_POP);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = sym_add;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_map;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_deriv;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CDR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_CONSTANT); // <--- not_add
+    *iter++ = sym_sub;
+    *iter++ = KevesInstruct(CMD_TEST_QEV_EQUAL_R);
+    *iter++ = KevesFixnum(17); // not_sub --->
+    *iter++ = KevesInstruct(CMD_POP);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = sym_sub;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_map;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_deriv;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CDR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_CONSTANT); // <--- not_sub
+    *iter++ = sym_mul;
+    *iter++ = KevesInstruct(CMD_TEST_QEV_EQUAL_R);
+    *iter++ = KevesFixnum(26); // not_mul --->
+    *iter++ = KevesInstruct(CMD_POP);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = sym_mul;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = sym_add;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_map;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_deriv_term;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CDR);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_list;
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT); // <--- not_mul
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH); // <--- atom
+    *iter++ = KevesInstruct(CMD_CONSTANT);
+    *iter++ = sym_x;
+    *iter++ = KevesInstruct(CMD_TEST_QEV_EQUAL_R);
+    *iter++ = KevesFixnum(2); // not_x --->
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT); // <--- not_x
+    *iter++ = KevesFixnum(0);
+    Q_ASSERT(iter <= code_deriv->end());
+  }
+
+  {
+    KevesIterator iter(code_deriv_term->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = sym_div;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_deriv;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_list;
+    *iter++ = KevesFixnum(3);
+    Q_ASSERT(iter <= code_deriv_term->end());
+  }
+
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(10000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(15); // last --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_deriv;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = expression;
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_POP);
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_loop;
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT); // <--- last
+    *iter++ = expression;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_deriv;
+    *iter++ = KevesFixnum(1);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  CodeKev* code(generator->makeCode(8));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (let loop ((i 0) (s ""))
+//   (if (< i 2000)
+//       (loop (+ i 1) (string-append s "abc"))
+//       (string-length s)))
+void BenchCode::StringAppend::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_string_append(generator->importBind("string-append"));
+  KevesValue proc_string_length(generator->importBind("string-length"));
+
+  StringKev* str_abc(generator->makeString("abc"));
+  StringKev* str_empty(generator->makeString(""));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_loop(generator->makeCode(29));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(2000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(16); // last --->
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_string_append;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = str_abc;
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA); // <--- return
+    *iter++ = proc_loop;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_string_length;
+    *iter++ = KevesFixnum(1);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  CodeKev* code(generator->makeCode(10));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = str_empty;
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (let loop ((i 1) (acc 1))
+//   (if (< i 1001)
+//       (loop (+ i 1) (* acc i))
+//       acc))
+void BenchCode::Factorial::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_mul(generator->importBind("*"));
+  KevesValue proc_lt(generator->importBind("<"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_loop(generator->makeCode(27));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1001);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(16); // last --->
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_mul;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA); // <--- return
+    *iter++ = proc_loop;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  CodeKev* code(generator->makeCode(10));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (define (fill v i)
+//   (if (< i 100000)
+//       (begin (vector-set! v i i) (fill v (+ i 1)))
+//       v))
+// (define (sum v i s)
+//   (if (< i 100000)
+//       (sum v (+ i 1) (+ s (vector-ref v i)))
+//       s))
+// (sum (fill (make-vector 100000 0) 0) 0 0)
+void BenchCode::Vector::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_make_vector(generator->importBind("make-vector"));
+  KevesValue proc_vector_set(generator->importBind("vector-set!"));
+  KevesValue proc_vector_ref(generator->importBind("vector-ref"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_fill(generator->makeCode(32));
+  LambdaKev* proc_fill(generator->makeLambda(clsr, code_fill, 0));
+  CodeKev* code_sum(generator->makeCode(33));
+  LambdaKev* proc_sum(generator->makeLambda(clsr, code_sum, 0));
+
+  {
+    KevesIterator iter(code_fill->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(100000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(21); // last --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_vector_set;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_POP); // <--- return
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_fill;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- last
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_fill->end());
+  }
+
+  {
+    KevesIterator iter(code_sum->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(100000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(22); // last --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_vector_ref;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_ADD_FX); // <--- return
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_sum;
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_sum->end());
+  }
+
+  CodeKev* code(generator->makeCode(26));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(23); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_sum;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(14);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_fill;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_make_vector;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(100000);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (define (make-alist i l)
+//   (if (= i 0) l (make-alist (- i 1) (cons (cons i i) l))))
+// (define (lookup alist k s)
+//   (if (< k 101)
+//       (lookup alist (+ k 1) (+ s (cdr (assq k alist))))
+//       s))
+// (define (repeat alist n s)
+//   (if (< n 1000)
+//       (repeat alist (+ n 1) (+ s (lookup alist 1 0)))
+//       s))
+// (repeat (make-alist 100 '()) 0 0)
+void BenchCode::Assq::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_sub(generator->importBind("-"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_num_eq(generator->importBind("="));
+  KevesValue proc_cons(generator->importBind("cons"));
+
+  if (!generator->setImportLibrary("rnrs", "lists", 6)) return;
+  KevesValue proc_assq(generator->importBind("assq"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_make_alist(generator->makeCode(34));
+  LambdaKev* proc_make_alist(generator->makeLambda(clsr, code_make_alist, 0));
+  CodeKev* code_lookup(generator->makeCode(36));
+  LambdaKev* proc_lookup(generator->makeLambda(clsr, code_lookup, 0));
+  CodeKev* code_repeat(generator->makeCode(35));
+  LambdaKev* proc_repeat(generator->makeLambda(clsr, code_repeat, 0));
+
+  {
+    KevesIterator iter(code_make_alist->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(0);
+    *iter++ = proc_num_eq;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(3); // else --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    *iter++ = KevesInstruct(CMD_SUB_FX_LOCAL); // <--- else
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(14); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- return2
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA); // <--- return1
+    *iter++ = proc_make_alist;
+    *iter++ = KevesFixnum(2);
+    Q_ASSERT(iter <= code_make_alist->end());
+  }
+
+  {
+    KevesIterator iter(code_lookup->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(101);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(25); // last --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_assq;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_CDR0); // <--- return
+    *iter++ = KevesInstruct(CMD_POP);
+    *iter++ = KevesInstruct(CMD_PUSH);
+    *iter++ = KevesInstruct(CMD_ADD_FX);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_lookup;
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_lookup->end());
+  }
+
+  {
+    KevesIterator iter(code_repeat->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(24); // last --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(9); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_lookup;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_ADD_FX); // <--- return
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_repeat;
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_repeat->end());
+  }
+
+  CodeKev* code(generator->makeCode(19));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_repeat;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_make_alist;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(100);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = EMB_NULL;
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+
+// Microbenchmarks of GC, which allocate pairs, vectors, frames and
+// closures in the patterns below.
+
+// (let loop ((i 0))
+//   (if (< i 1000000)
+//       (begin (cons i i) (loop (+ i 1)))
+//       i))
+void BenchCode::GcPairChurn::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_cons(generator->importBind("cons"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_loop(generator->makeCode(28));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1000000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(17); // last --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_POP); // <--- return
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_loop;
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  CodeKev* code(generator->makeCode(8));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (let loop ((i 0) (l '()))
+//   (if (< i 200000)
+//       (loop (+ i 1) (cons i l))
+//       (length l)))
+void BenchCode::GcGrowingList::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_cons(generator->importBind("cons"));
+  KevesValue proc_length(generator->importBind("length"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_loop(generator->makeCode(29));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(200000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(16); // last --->
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA); // <--- return
+    *iter++ = proc_loop;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_length;
+    *iter++ = KevesFixnum(1);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  CodeKev* code(generator->makeCode(10));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = EMB_NULL;
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (let loop ((i 0) (v #f))
+//   (if (< i 1000)
+//       (loop (+ i 1) (make-vector 10000 i))
+//       (vector-ref v 9999)))
+void BenchCode::GcLargeVectors::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_make_vector(generator->importBind("make-vector"));
+  KevesValue proc_vector_ref(generator->importBind("vector-ref"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_loop(generator->makeCode(31));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(16); // last --->
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_make_vector;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(10000);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA); // <--- return
+    *iter++ = proc_loop;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(9999);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_vector_ref;
+    *iter++ = KevesFixnum(2);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  CodeKev* code(generator->makeCode(10));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = EMB_FALSE;
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (define (fill v i)
+//   (if (< i 1000)
+//       (begin (vector-set! v i (cons i i)) (fill v (+ i 1)))
+//       v))
+// (define (repeat v n)
+//   (if (< n 1000)
+//       (begin (fill v 0) (repeat v (+ n 1)))
+//       (vector-ref v 999)))
+// (repeat (make-vector 1000 0) 0)
+void BenchCode::GcTenuredMutation::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_cons(generator->importBind("cons"));
+  KevesValue proc_make_vector(generator->importBind("make-vector"));
+  KevesValue proc_vector_set(generator->importBind("vector-set!"));
+  KevesValue proc_vector_ref(generator->importBind("vector-ref"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_fill(generator->makeCode(39));
+  LambdaKev* proc_fill(generator->makeLambda(clsr, code_fill, 0));
+  CodeKev* code_repeat(generator->makeCode(31));
+  LambdaKev* proc_repeat(generator->makeLambda(clsr, code_repeat, 0));
+
+  {
+    KevesIterator iter(code_fill->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(28); // last --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_vector_set;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_APPLY); // <--- return2
+    *iter++ = KevesInstruct(CMD_POP); // <--- return1
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_fill;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- last
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_fill->end());
+  }
+
+  {
+    KevesIterator iter(code_repeat->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(16); // last --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_fill;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL); // <--- return
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_repeat;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- last
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(999);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_vector_ref;
+    *iter++ = KevesFixnum(2);
+    Q_ASSERT(iter <= code_repeat->end());
+  }
+
+  CodeKev* code(generator->makeCode(17));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(14); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_repeat;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_make_vector;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1000);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (define (build n)
+//   (if (= n 0) '() (cons n (build (- n 1)))))
+// (define (repeat i s)
+//   (if (< i 10)
+//       (repeat (+ i 1) (+ s (length (build 100000))))
+//       s))
+// (repeat 0 0)
+void BenchCode::GcDeepRecursion::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_sub(generator->importBind("-"));
+  KevesValue proc_lt(generator->importBind("<"));
+  KevesValue proc_num_eq(generator->importBind("="));
+  KevesValue proc_cons(generator->importBind("cons"));
+  KevesValue proc_length(generator->importBind("length"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_build(generator->makeCode(24));
+  LambdaKev* proc_build(generator->makeLambda(clsr, code_build, 0));
+  CodeKev* code_repeat(generator->makeCode(34));
+  LambdaKev* proc_repeat(generator->makeLambda(clsr, code_repeat, 0));
+
+  {
+    KevesIterator iter(code_build->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_LOCAL_R);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = proc_num_eq;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(2); // else --->
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT);
+    *iter++ = EMB_NULL;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- else
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_build;
+    *iter++ = KevesInstruct(CMD_SUB_FX_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_sub;
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT); // <--- return
+    *iter++ = proc_cons;
+    *iter++ = KevesFixnum(2);
+    Q_ASSERT(iter <= code_build->end());
+  }
+
+  {
+    KevesIterator iter(code_repeat->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(10);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(23); // last --->
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(10); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_length;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // return2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_build;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(100000);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_APPLY); // <--- return2
+    *iter++ = KevesInstruct(CMD_ADD_FX); // <--- return1
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_repeat;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_repeat->end());
+  }
+
+  CodeKev* code(generator->makeCode(10));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_repeat;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// (define (make-adder y) (lambda (x) (+ x y)))
+// (let loop ((i 0) (s 0))
+//   (if (< i 100000)
+//       (loop (+ i 1) (+ s ((make-adder i) 1)))
+//       s))
+void BenchCode::GcClosures::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_lt(generator->importBind("<"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  CodeKev* code_make_adder(generator->makeCode(15));
+  LambdaKev* proc_make_adder(generator->makeLambda(clsr, code_make_adder, 0));
+  CodeKev* code_loop(generator->makeCode(34));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+
+  {
+    KevesIterator iter(code_make_adder->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_CLOSE_R);
+    *iter++ = KevesFixnum(8); // close --->
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_ADD_FX);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_RETURN);
+    *iter++ = KevesInstruct(CMD_RETURN0); // <--- close
+    Q_ASSERT(iter <= code_make_adder->end());
+  }
+
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_LT_FX_LOCAL_R);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(100000);
+    *iter++ = proc_lt;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(23); // last --->
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(10); // return1 --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // return2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_make_adder;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT); // <--- return2
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_ADD_FX); // <--- return1
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_LAMBDA);
+    *iter++ = proc_loop;
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- last
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  CodeKev* code(generator->makeCode(10));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY_LAMBDA);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
@@ -0,0 +1,90 @@
+// keves/kevc_generator/bench_code.hpp - benchmark programs for kevc_generator
+// Keves will be an R6RS Scheme implementation.
+//
+// Copyright (C) 2014  Yasuhiro Yamakawa <kawatab@yahoo.co.jp>
+//
+//  This program is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or any
+//  later version.
+// 
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+//  License for more details.
+// 
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+
+class KevcGenerator;
+
+
+namespace BenchCode {
+  namespace Fib {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace FibGeneric {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Tak {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Ctak {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Nqueens {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Deriv {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace StringAppend {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Factorial {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Vector {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Assq {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace GcPairChurn {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace GcGrowingList {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace GcLargeVectors {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace GcTenuredMutation {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace GcDeepRecursion {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace GcClosures {
+    void write(KevcGenerator* generator);
+  };
+};
@@ -37,6 +37,7 @@ void Code_KevesBase::write(KevcGenerator* generator) {
   const EnvironmentKev* environment(makeEnvironment(generator));
 
   generator->exportBind("my-code", code_evaluate);
+  generator->exportBind("expand", proc_expand);
   generator->exportBind("environment", environment);
 
   generator->writeToFile();
@@ -156,16 +157,12 @@ const LambdaKev* Code_KevesBase::makeExpand(KevcGenerator* generator) {
   KevesValue list_FRAME_R_5_PUSH_CONSTANT_display_PUSH_CONSTANT(generator->makePair(KevesInstruct(CMD_FRAME_R), list_5_PUSH_CONSTANT_display_PUSH_CONSTANT));
   KevesValue list_0_FRAME_R_5_PUSH_CONSTANT_display_PUSH_CONSTANT(generator->makePair(KevesFixnum(0), list_FRAME_R_5_PUSH_CONSTANT_display_PUSH_CONSTANT));
 
-  CodeKev* code(generator->makeCode(17));
+  CodeKev* code(generator->makeCode(14));
   {
     KevesIterator iter(code->begin());
 
     *iter++ = KevesInstruct(CMD_LAST);
     {
-      *iter++ = KevesInstruct(CMD_FRAME_R);
-      *iter++ = KevesFixnum(13);
-      *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-      *iter++ = proc_append;
       *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
       *iter++ = list_0_FRAME_R_5_PUSH_CONSTANT_display_PUSH_CONSTANT;
       {
@@ -178,11 +175,11 @@ const LambdaKev* Code_KevesBase::makeExpand(KevcGenerator* generator) {
 	*iter++ = list_APPLY_HALT;
 	*iter++ = KevesInstruct(CMD_APPLY);
       }
-      *iter++ = KevesInstruct(CMD_APPLY);
+      *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+      *iter++ = proc_append;
+      *iter++ = KevesFixnum(2);
     }
 
-    *iter++ = KevesInstruct(CMD_RETURN0);
-
     Q_ASSERT(iter <= code->end());
   }
 
@@ -219,7 +219,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
   StringKev* str_string_is_not_terminated(generator->makeString("string is not terminated."));
   SymbolKev* sym_Zs(generator->makeSymbol("Zs"));
 
-  CodeKev* code(generator->makeCode(5240));
+  CodeKev* code(generator->makeCode(5135));
   {
     KevesIterator iter(code->begin());
     
@@ -240,7 +240,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(28); // first local value
 
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(31);
+    *iter++ = KevesFixnum(29);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -257,13 +257,9 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(15);
+    *iter++ = KevesFixnum(13);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(12);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_symbol_eq_q;
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = proc_char_general_category;
@@ -272,13 +268,15 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = sym_Zs;
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_symbol_eq_q;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(27);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(102);
+    *iter++ = KevesFixnum(100);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -293,7 +291,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(88);
+    *iter++ = KevesFixnum(86);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -306,7 +304,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(75);
+    *iter++ = KevesFixnum(73);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -319,7 +317,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(62);
+    *iter++ = KevesFixnum(60);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -332,7 +330,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(49);
+    *iter++ = KevesFixnum(47);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -345,7 +343,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(36);
+    *iter++ = KevesFixnum(34);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -358,7 +356,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(23);
+    *iter++ = KevesFixnum(21);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -371,23 +369,21 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(10);
+    *iter++ = KevesFixnum(8);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_char_eq_q;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesChar('\x22');
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_char_eq_q;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(26);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(52);
+    *iter++ = KevesFixnum(50);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -404,7 +400,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(36);
+    *iter++ = KevesFixnum(34);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -417,7 +413,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(23);
+    *iter++ = KevesFixnum(21);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -430,38 +426,33 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(10);
+    *iter++ = KevesFixnum(8);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_char_eq_q;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesChar(QChar(0x2028));
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_char_eq_q;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(25);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(10);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_char_eq_q;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesChar(QChar(0x2029));
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_char_eq_q;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(24);
     *iter++ = KevesInstruct(CMD_POP);
@@ -518,25 +509,19 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(23);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(162);
+    *iter++ = KevesFixnum(155);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(156);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(142);
+    *iter++ = KevesFixnum(137);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(136);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_substring;
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -579,7 +564,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(83);
+    *iter++ = KevesFixnum(81);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -590,7 +575,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x0d');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(70);
+    *iter++ = KevesFixnum(68);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -607,12 +592,12 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_R);
-    *iter++ = KevesFixnum(43);
+    *iter++ = KevesFixnum(41);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(40);
+    *iter++ = KevesFixnum(38);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(26);
+    *iter++ = KevesFixnum(24);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -629,17 +614,15 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(10);
+    *iter++ = KevesFixnum(8);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_char_eq_q;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesChar('\x85');
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_char_eq_q;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -670,8 +653,9 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_substring;
+    *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -681,22 +665,18 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(22);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(42);
+    *iter++ = KevesFixnum(39);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(36);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_substring;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -730,13 +710,14 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_substring;
+    *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(21);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(78);
+    *iter++ = KevesFixnum(72);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(2);
@@ -757,11 +738,11 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(51);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(47);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(43);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(33);
+    *iter++ = KevesFixnum(29);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -779,23 +760,19 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(16);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(14);
+    *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(10);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_add;
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(1);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_ADD_FX);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -808,27 +785,23 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_string_length;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(1);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_string_length;
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(20);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(29);
+    *iter++ = KevesFixnum(27);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(23);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -851,13 +824,13 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(19);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(126);
+    *iter++ = KevesFixnum(127);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(4);
@@ -889,7 +862,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(95);
+    *iter++ = KevesFixnum(96);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -923,7 +896,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(61);
+    *iter++ = KevesFixnum(62);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -957,9 +930,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(27);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(28);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(25);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(10);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -990,22 +964,20 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(18);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(163);
+    *iter++ = KevesFixnum(160);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(30);
+    *iter++ = KevesFixnum(28);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(24);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = proc_caar;
@@ -1028,15 +1000,13 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(120);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(81);
+    *iter++ = KevesFixnum(82);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(3);
@@ -1066,18 +1036,17 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_datum_comment_is_not_terminated;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(52);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(50);
+    *iter++ = KevesFixnum(53);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(36);
+    *iter++ = KevesFixnum(38);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -1093,10 +1062,11 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(14);
+    *iter++ = KevesFixnum(15);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(24);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -1118,7 +1088,8 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(14);
@@ -1154,22 +1125,20 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(17);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(214);
+    *iter++ = KevesFixnum(210);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(208);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(203);
+    *iter++ = KevesFixnum(201);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
@@ -1228,9 +1197,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(17);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
@@ -1243,7 +1213,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(87);
+    *iter++ = KevesFixnum(86);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(16);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -1305,9 +1275,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(25);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(23);
+    *iter++ = KevesFixnum(24);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -1330,13 +1298,12 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = EMB_NULL;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(37);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -1373,15 +1340,15 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(16);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(165);
+    *iter++ = KevesFixnum(161);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -1406,19 +1373,17 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_R);
-    *iter++ = KevesFixnum(141);
+    *iter++ = KevesFixnum(137);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(138);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(133);
+    *iter++ = KevesFixnum(130);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(110);
+    *iter++ = KevesFixnum(109);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -1443,7 +1408,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(16);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(86);
+    *iter++ = KevesFixnum(85);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -1517,9 +1482,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = EMB_FALSE;
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(12);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(10);
+    *iter++ = KevesFixnum(11);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -1529,13 +1492,12 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(10);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -1545,24 +1507,23 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(15);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(96);
+    *iter++ = KevesFixnum(92);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(90);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(78);
+    *iter++ = KevesFixnum(76);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -1632,16 +1593,14 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(9);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_assertion_violation;
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = sym_keves_parser;
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = str_invalid_number_character;
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_assertion_violation;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
@@ -1650,36 +1609,32 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(14);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(138);
+    *iter++ = KevesFixnum(132);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(132);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(127);
+    *iter++ = KevesFixnum(123);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(109);
+    *iter++ = KevesFixnum(107);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(103);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
     *iter++ = KevesFixnum(91);
     *iter++ = KevesFixnum(1);
@@ -1782,21 +1737,19 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = pair_abbr_list;
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(13);
     *iter++ = KevesInstruct(CMD_POP);
@@ -1807,10 +1760,8 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(449);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(426);
+    *iter++ = KevesFixnum(428);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(2);
@@ -1826,7 +1777,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x23');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(396);
+    *iter++ = KevesFixnum(397);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -1837,27 +1788,24 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(367);
+    *iter++ = KevesFixnum(368);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(363);
+    *iter++ = KevesFixnum(364);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(349);
+    *iter++ = KevesFixnum(350);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_equal;
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(2);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_R);
+    *iter++ = proc_equal;
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(168);
+    *iter++ = KevesFixnum(172);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -1881,9 +1829,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x54');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(17);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(18);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(23);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -1898,7 +1847,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(125);
+    *iter++ = KevesFixnum(128);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -1922,9 +1871,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x46');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(17);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(18);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(23);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -1939,7 +1889,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(84);
+    *iter++ = KevesFixnum(86);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -1955,7 +1905,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(52);
+    *iter++ = KevesFixnum(54);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -1966,9 +1916,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x5c');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(17);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(18);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(24);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -1983,9 +1934,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(22);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(23);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(20);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(25);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -2101,11 +2053,11 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(65);
+    *iter++ = KevesFixnum(67);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(61);
+    *iter++ = KevesFixnum(63);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(47);
+    *iter++ = KevesFixnum(49);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -2121,9 +2073,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x5c');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(17);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(18);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(25);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -2138,9 +2091,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(26);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -2166,12 +2120,8 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(25);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(23);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_assertion_violation;
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = sym_keves_parser;
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(16);
@@ -2191,7 +2141,9 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_assertion_violation;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -2222,9 +2174,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(24);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -2257,20 +2210,18 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(36);
+    *iter++ = KevesFixnum(34);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(30);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -2300,38 +2251,34 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(11);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(352);
+    *iter++ = KevesFixnum(341);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(346);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(341);
+    *iter++ = KevesFixnum(332);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(323);
+    *iter++ = KevesFixnum(316);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(317);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(305);
+    *iter++ = KevesFixnum(300);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -2420,7 +2367,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(217);
+    *iter++ = KevesFixnum(212);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(10);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -2448,7 +2395,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(189);
+    *iter++ = KevesFixnum(184);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -2496,17 +2443,14 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(10);
-    *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_equal;
+    *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(3);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_R);
+    *iter++ = proc_equal;
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
     *iter++ = KevesFixnum(41);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -2549,7 +2493,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(88);
+    *iter++ = KevesFixnum(86);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -2628,16 +2572,14 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(9);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_assertion_violation;
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = sym_keves_parser;
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = str_invalid_form_character;
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_assertion_violation;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
@@ -2646,35 +2588,31 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = pair_char_name_list;
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(10);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(94);
+    *iter++ = KevesFixnum(90);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(88);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(67);
+    *iter++ = KevesFixnum(65);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -2717,12 +2655,8 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(25);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(23);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_assertion_violation;
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = sym_keves_parser;
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(16);
@@ -2742,7 +2676,9 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_assertion_violation;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(14);
@@ -2760,29 +2696,25 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(9);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(87);
+    *iter++ = KevesFixnum(83);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(81);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(65);
+    *iter++ = KevesFixnum(63);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(59);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -2841,8 +2773,8 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(4);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(9);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -2854,22 +2786,20 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(8);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(454);
+    *iter++ = KevesFixnum(462);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(448);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(434);
+    *iter++ = KevesFixnum(444);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -2883,9 +2813,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(14);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -2898,7 +2829,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(406);
+    *iter++ = KevesFixnum(415);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -2909,9 +2840,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x3b');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(15);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -2924,7 +2856,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(380);
+    *iter++ = KevesFixnum(388);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -2935,9 +2867,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x28');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(19);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(20);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(15);
+    *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(27);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -2954,7 +2887,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(350);
+    *iter++ = KevesFixnum(357);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -2965,9 +2898,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x5b');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(19);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(20);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(15);
+    *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(27);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -2984,7 +2918,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(320);
+    *iter++ = KevesFixnum(326);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -2993,9 +2927,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(22);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(23);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(18);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(31);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3015,7 +2950,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(289);
+    *iter++ = KevesFixnum(294);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3053,9 +2988,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3068,7 +3004,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(236);
+    *iter++ = KevesFixnum(240);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3106,9 +3042,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(30);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3121,7 +3058,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(183);
+    *iter++ = KevesFixnum(186);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3132,9 +3069,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x22');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(32);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3147,7 +3085,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(157);
+    *iter++ = KevesFixnum(159);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3185,9 +3123,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(16);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3200,7 +3139,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(104);
+    *iter++ = KevesFixnum(105);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3238,9 +3177,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(15);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(17);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3315,20 +3255,18 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(277);
+    *iter++ = KevesFixnum(275);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(271);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
     *iter++ = KevesFixnum(266);
     *iter++ = KevesFixnum(6);
@@ -3337,7 +3275,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(216);
+    *iter++ = KevesFixnum(218);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(3);
@@ -3367,18 +3305,17 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_unmatched_parenthesis;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(187);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(185);
+    *iter++ = KevesFixnum(189);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(171);
+    *iter++ = KevesFixnum(174);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(31);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3394,7 +3331,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(149);
+    *iter++ = KevesFixnum(151);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -3460,7 +3397,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(83);
+    *iter++ = KevesFixnum(85);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3482,7 +3419,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_unmatched_parenthesis;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(61);
+    *iter++ = KevesFixnum(63);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3513,9 +3450,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(17);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(18);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(33);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3530,9 +3468,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(13);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(14);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(26);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3554,13 +3493,12 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(37);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -3597,31 +3535,29 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(301);
+    *iter++ = KevesFixnum(295);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(295);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(290);
+    *iter++ = KevesFixnum(286);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(240);
+    *iter++ = KevesFixnum(238);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(3);
@@ -3651,18 +3587,17 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_unmatched_parenthesis;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(211);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(209);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(195);
+    *iter++ = KevesFixnum(194);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(30);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3678,7 +3613,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(173);
+    *iter++ = KevesFixnum(171);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -3690,7 +3625,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(126);
+    *iter++ = KevesFixnum(123);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3715,9 +3650,9 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(83);
+    *iter++ = KevesFixnum(80);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(79);
+    *iter++ = KevesFixnum(76);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3742,30 +3677,27 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(46);
+    *iter++ = KevesFixnum(43);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = proc_cons;
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(34);
+    *iter++ = KevesFixnum(31);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = proc_fold_left;
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(10);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_cons;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(1);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_cons;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3816,7 +3748,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(35);
+    *iter++ = KevesFixnum(36);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -3838,9 +3770,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_unmatched_parenthesis;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(13);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(14);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(25);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3862,13 +3795,12 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(37);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -3905,31 +3837,29 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(234);
+    *iter++ = KevesFixnum(231);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(228);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(223);
+    *iter++ = KevesFixnum(222);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(173);
+    *iter++ = KevesFixnum(174);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(3);
@@ -3959,18 +3889,17 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_unmatched_parenthesis;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(144);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(142);
+    *iter++ = KevesFixnum(145);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(128);
+    *iter++ = KevesFixnum(130);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -3986,7 +3915,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(106);
+    *iter++ = KevesFixnum(107);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -4057,7 +3986,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(35);
+    *iter++ = KevesFixnum(36);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -4079,9 +4008,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_unmatched_parenthesis;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(13);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(14);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(24);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -4103,13 +4033,12 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(37);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -4146,31 +4075,29 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(234);
+    *iter++ = KevesFixnum(231);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(228);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(223);
+    *iter++ = KevesFixnum(222);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(173);
+    *iter++ = KevesFixnum(174);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(3);
@@ -4200,18 +4127,17 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_unmatched_parenthesis;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(144);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(142);
+    *iter++ = KevesFixnum(145);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(128);
+    *iter++ = KevesFixnum(130);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -4227,7 +4153,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(106);
+    *iter++ = KevesFixnum(107);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -4298,7 +4224,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(35);
+    *iter++ = KevesFixnum(36);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -4320,9 +4246,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_unmatched_parenthesis;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(13);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(14);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(24);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -4344,13 +4271,12 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(37);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -4387,30 +4313,28 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(174);
+    *iter++ = KevesFixnum(172);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(49);
+    *iter++ = KevesFixnum(47);
     *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(43);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = proc_caar;
@@ -4452,15 +4376,13 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(112);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(63);
+    *iter++ = KevesFixnum(65);
     *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(3);
@@ -4492,9 +4414,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_quote_is_not_terminated;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(32);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(34);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(27);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -4510,10 +4433,11 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(14);
+    *iter++ = KevesFixnum(15);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(22);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
@@ -4570,29 +4494,27 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(321);
+    *iter++ = KevesFixnum(313);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(315);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(310);
+    *iter++ = KevesFixnum(304);
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(256);
+    *iter++ = KevesFixnum(249);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(5);
@@ -4624,11 +4546,9 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_string_is_not_terminated;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(225);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(223);
+    *iter++ = KevesFixnum(218);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(209);
+    *iter++ = KevesFixnum(203);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
@@ -4644,20 +4564,18 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x5c');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(77);
+    *iter++ = KevesFixnum(76);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(73);
+    *iter++ = KevesFixnum(72);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = proc_call_with_values;
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(43);
+    *iter++ = KevesFixnum(41);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(37);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(39);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -4694,17 +4612,18 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(19);
+    *iter++ = KevesFixnum(20);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
@@ -4721,7 +4640,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(117);
+    *iter++ = KevesFixnum(112);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -4732,9 +4651,9 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x22');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(84);
+    *iter++ = KevesFixnum(81);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(80);
+    *iter++ = KevesFixnum(77);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -4743,20 +4662,17 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(4);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(21);
+    *iter++ = KevesFixnum(18);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = proc_substring;
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_add;
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(1);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_ADD_FX);
+    *iter++ = proc_add;
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -4816,24 +4732,22 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(22);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(20);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
+    *iter++ = KevesFixnum(17);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(1);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_add;
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(1);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_ADD_FX);
+    *iter++ = proc_add;
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -4849,13 +4763,15 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(41);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -4898,29 +4814,27 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(390);
+    *iter++ = KevesFixnum(372);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(384);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(379);
+    *iter++ = KevesFixnum(363);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(352);
+    *iter++ = KevesFixnum(338);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(2);
@@ -4945,7 +4859,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_invalid_form_escape_sequence;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(328);
+    *iter++ = KevesFixnum(314);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -5003,7 +4917,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(270);
+    *iter++ = KevesFixnum(256);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -5052,7 +4966,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(221);
+    *iter++ = KevesFixnum(207);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -5096,7 +5010,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(177);
+    *iter++ = KevesFixnum(163);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -5107,34 +5021,31 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x78');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(152);
+    *iter++ = KevesFixnum(139);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(148);
+    *iter++ = KevesFixnum(135);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(143);
+    *iter++ = KevesFixnum(130);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(118);
+    *iter++ = KevesFixnum(107);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_less_than;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_LT_FX_R);
+    *iter++ = proc_less_than;
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(94);
+    *iter++ = KevesFixnum(88);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(14);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -5152,26 +5063,23 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesChar('\x3b');
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
-    *iter++ = KevesFixnum(58);
+    *iter++ = KevesFixnum(55);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(54);
+    *iter++ = KevesFixnum(51);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = proc_values;
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(21);
+    *iter++ = KevesFixnum(18);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = proc_substring;
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(4);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_add;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(1);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_ADD_FX);
+    *iter++ = proc_add;
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -5210,40 +5118,33 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(16);
+    *iter++ = KevesFixnum(13);
     *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(14);
+    *iter++ = KevesFixnum(11);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(7);
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_add;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(1);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_ADD_FX);
+    *iter++ = proc_add;
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(9);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
-    *iter++ = proc_assertion_violation;
-    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = sym_keves_parser;
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = str_invalid_form_escape_sequence;
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_assertion_violation;
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(12);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -5255,13 +5156,11 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(14);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(12);
+    *iter++ = KevesFixnum(13);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_FRAME_R);
@@ -5273,13 +5172,12 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(14);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
@@ -5293,24 +5191,22 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(3);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(166);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(161);
+    *iter++ = KevesFixnum(160);
     *iter++ = KevesFixnum(29);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(139);
+    *iter++ = KevesFixnum(140);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(3);
@@ -5363,18 +5259,17 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(87);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(85);
+    *iter++ = KevesFixnum(88);
     *iter++ = KevesInstruct(CMD_CLOSE_R);
-    *iter++ = KevesFixnum(71);
+    *iter++ = KevesFixnum(73);
     *iter++ = KevesFixnum(3);
     *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
     *iter++ = KevesFixnum(1);
     *iter++ = KevesInstruct(CMD_BOX);
     *iter++ = KevesFixnum(0);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(13);
+    *iter++ = KevesFixnum(6);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(25);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -5390,7 +5285,7 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_LAST);
     *iter++ = KevesInstruct(CMD_TEST_NOT_R);
-    *iter++ = KevesFixnum(49);
+    *iter++ = KevesFixnum(50);
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_FRAME_R);
     *iter++ = KevesFixnum(7);
@@ -5426,9 +5321,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = str_unmatched_parenthesis;
     *iter++ = KevesInstruct(CMD_APPLY);
     *iter++ = KevesInstruct(CMD_JUMP_R);
-    *iter++ = KevesFixnum(13);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(14);
+    *iter++ = KevesInstruct(CMD_FRAME_N_R);
     *iter++ = KevesFixnum(11);
+    *iter++ = KevesFixnum(5);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
     *iter++ = KevesFixnum(20);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -5450,13 +5346,12 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(2);
     *iter++ = KevesInstruct(CMD_RETURN0);
     *iter++ = KevesInstruct(CMD_ASSIGN_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_POP);
-    *iter++ = KevesInstruct(CMD_FRAME_R);
-    *iter++ = KevesFixnum(9);
     *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
     *iter++ = KevesFixnum(0);
     *iter++ = KevesInstruct(CMD_REFER_FREE0);
@@ -5465,10 +5360,10 @@ KevesValue Code_KevesParse::makeLambda_qeves_parser(KevcGenerator* generator,
     *iter++ = EMB_NULL;
     *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
     *iter++ = EMB_NULL;
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
-    *iter++ = KevesInstruct(CMD_APPLY);
-    *iter++ = KevesInstruct(CMD_RETURN0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY);
+    *iter++ = KevesFixnum(1);
     // *iter++ = KevesInstruct(CMD_HALT);
     Q_ASSERT(iter <= code->end());
   }
@@ -58,6 +58,8 @@ void Code_RnrsBase::write(KevcGenerator* generator) {
     "boolean?",
     "call/cc",
     "call-with-current-continuation",
+    "call/ec",
+    "call-with-escape-continuation",
     "call-with-values",
     "car",
     "cdr",
@@ -122,7 +122,7 @@ ArgumentFrameKev* KevcGenerator::makeArgumentFrame(int size) {
 }
 
 KevesValue KevcGenerator::makeAssertCondition(const SymbolKev* who,
-					      const char* message,
+					      KevesBuiltinValues::mesg_id message,
 					      KevesValue irritants) {
   return common_->makeAssertCondition(who,
 				      common_->getMesgText(message),
@@ -145,8 +145,8 @@ EnvironmentKev* KevcGenerator::makeEnvironment(KevesValue values) {
   return EnvironmentKev::make(common_, values);
 }
 
-FlonumKev* KevcGenerator::makeFlonum(double value) {
-  return FlonumKev::make(common_, value);
+KevesValue KevcGenerator::makeFlonum(double value) {
+  return FlonumKev::makeValue(common_, value);
 }
 
 InexactComplexNumberKev* KevcGenerator::makeInexactComplexNumber(double real,
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "keves_builtin_values.hpp"
 #include "keves_library.hpp"
 
 
@@ -64,14 +65,14 @@ public:
   ArgumentFrameKev* makeArgumentFrame(int size);
 
   KevesValue makeAssertCondition(const SymbolKev* who,
-				 const char* message,
+				 KevesBuiltinValues::mesg_id message,
 				 KevesValue irritants);
 
   Bignum* makeBignum(const char* str);
   CodeKev* makeCode(int size);
   EnvironmentKev* makeEnvironment(KevesValue values);
   ExactComplexNumberKev* makeExactComplexNumber();
-  FlonumKev* makeFlonum(double value);
+  KevesValue makeFlonum(double value);
   InexactComplexNumberKev* makeInexactComplexNumber(double real, double imag);
   LambdaKev* makeLambda(LocalVarFrameKev* free_vars, CodeKev* code, int index);
   LocalVarFrameKev* makeLocalVarFrame(int size, LocalVarFrameKev* next);
@@ -6,11 +6,12 @@ TEMPLATE = app
 TARGET = 
 DEPENDPATH += . ..
 INCLUDEPATH += . ..
-LIBS += -lgmpxx -lgmp -L/usr/lib/keves/keves/base/
+LIBS += -lgmpxx -lgmp -lrt -L/usr/lib/keves/keves/base/
 QMAKE_CXXFLAGS += -std=c++11
 
 # Input
 HEADERS += kevc_generator.hpp \
+           bench_code.hpp \
            code_keves-base.hpp \
            code_keves-parse.hpp \
            code_rnrs-base.hpp \
@@ -25,6 +26,8 @@ HEADERS += kevc_generator.hpp \
            keves_gc.hpp \
            keves_iterator.hpp \
            keves_library.hpp \
+           keves_log.hpp \
+           keves_profile.hpp \
            keves_template.hpp \
            keves_textual_port.hpp \
            keves_value.hpp \
@@ -50,6 +53,7 @@ HEADERS += kevc_generator.hpp \
 
 SOURCES += main.cpp \
            kevc_generator.cpp \
+           bench_code.cpp \
            code_keves-base.cpp \
            code_keves-parse.cpp \
            code_rnrs-base.cpp \
@@ -63,6 +67,8 @@ SOURCES += main.cpp \
            keves_gc.cpp \
            keves_iterator.cpp \
            keves_library.cpp \
+           keves_log.cpp \
+           keves_profile.cpp \
            keves_template.cpp \
            keves_textual_port.cpp \
            keves_value.cpp \
@@ -87,3 +93,5 @@ SOURCES += main.cpp \
 
 CONFIG += debug
 # CONFIG += qt release
+# DEFINES += KEVES_TRACE
+# DEFINES += KEVES_LOG_MIN_LEVEL=KEVES_LOG_INFO
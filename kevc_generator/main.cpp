@@ -17,6 +17,7 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 
+#include "bench_code.hpp"
 #include "code_keves-base.hpp"
 #include "code_keves-parse.hpp"
 #include "code_rnrs-base.hpp"
@@ -92,8 +93,154 @@ int main() {
     Code_KevesBase::write(&generator);
   }
 
+  {
+    KevcGenerator generator(&common, "test04.kevc", "main");
+    TestCode::Code04::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "test05.kevc", "main");
+    TestCode::Code05::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "test06.kevc", "main");
+    TestCode::Code06::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "test07.kevc", "main");
+    TestCode::Code07::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "test08.kevc", "main");
+    TestCode::Code08::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "test09.kevc", "main");
+    TestCode::Code09::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/fib.kevc",
+			    "bench", "fib", 0, 1);
+
+    BenchCode::Fib::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/fib-generic.kevc",
+			    "bench", "fib-generic", 0, 1);
+
+    BenchCode::FibGeneric::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/tak.kevc",
+			    "bench", "tak", 0, 1);
+
+    BenchCode::Tak::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/ctak.kevc",
+			    "bench", "ctak", 0, 1);
+
+    BenchCode::Ctak::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/nqueens.kevc",
+			    "bench", "nqueens", 0, 1);
+
+    BenchCode::Nqueens::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/deriv.kevc",
+			    "bench", "deriv", 0, 1);
+
+    BenchCode::Deriv::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/string-append.kevc",
+			    "bench", "string-append", 0, 1);
+
+    BenchCode::StringAppend::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/factorial.kevc",
+			    "bench", "factorial", 0, 1);
+
+    BenchCode::Factorial::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/vector.kevc",
+			    "bench", "vector", 0, 1);
+
+    BenchCode::Vector::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/assq.kevc",
+			    "bench", "assq", 0, 1);
+
+    BenchCode::Assq::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/gc-pair-churn.kevc",
+			    "bench", "gc-pair-churn", 0, 1);
+
+    BenchCode::GcPairChurn::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/gc-growing-list.kevc",
+			    "bench", "gc-growing-list", 0, 1);
+
+    BenchCode::GcGrowingList::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/gc-large-vectors.kevc",
+			    "bench", "gc-large-vectors", 0, 1);
+
+    BenchCode::GcLargeVectors::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/gc-tenured-mutation.kevc",
+			    "bench", "gc-tenured-mutation", 0, 1);
+
+    BenchCode::GcTenuredMutation::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/gc-deep-recursion.kevc",
+			    "bench", "gc-deep-recursion", 0, 1);
+
+    BenchCode::GcDeepRecursion::write(&generator);
+  }
+
+  {
+    KevcGenerator generator(&common, "lib/bench/gc-closures.kevc",
+			    "bench", "gc-closures", 0, 1);
+
+    BenchCode::GcClosures::write(&generator);
+  }
+
   KevcGenerator::testRead(&common, "test02.kevc");
   KevcGenerator::testRead(&common, "test03.kevc");
+  KevcGenerator::testRead(&common, "test04.kevc");
+  KevcGenerator::testRead(&common, "test05.kevc");
+  KevcGenerator::testRead(&common, "test06.kevc");
+  KevcGenerator::testRead(&common, "test07.kevc");
   KevcGenerator::testRead(&common, "lib/rnrs/exceptions.kevc");
   KevcGenerator::testRead(&common, "lib/rnrs/lists.kevc");
   KevcGenerator::testRead(&common, "lib/rnrs/mutable-strings.kevc");
@@ -101,6 +248,22 @@ int main() {
   KevcGenerator::testRead(&common, "lib/rnrs/base.kevc");
   KevcGenerator::testRead(&common, "lib/keves/parse.kevc");
   KevcGenerator::testRead(&common, "lib/keves/base.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/fib.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/fib-generic.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/tak.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/ctak.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/nqueens.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/deriv.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/string-append.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/factorial.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/vector.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/assq.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/gc-pair-churn.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/gc-growing-list.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/gc-large-vectors.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/gc-tenured-mutation.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/gc-deep-recursion.kevc");
+  KevcGenerator::testRead(&common, "lib/bench/gc-closures.kevc");
 
   return 0;
 }
@@ -20,6 +20,8 @@
 #include "test_code.hpp"
 
 #include "kevc_generator.hpp"
+#include "kev/code.hpp"
+#include "kev/environment.hpp"
 #include "kev/number.hpp"
 #include "kev/pair.hpp"
 #include "kev/procedure.hpp"
@@ -28,6 +30,7 @@
 #include "kev/symbol.hpp"
 #include "kev/vector.hpp"
 #include "value/char.hpp"
+#include "value/fixnum.hpp"
 #include "value/instruct.hpp"
 
 
@@ -56,7 +59,7 @@ void TestCode::Code02::write(KevcGenerator* generator) {
   StringKev* str_num(generator->makeString("123423423414127897/8907807843218742"));
 
   RationalNumberKev* rational(generator->makeRationalNumber(str_num));
-  FlonumKev* flonum(generator->makeFlonum(1.2345678));
+  KevesValue flonum(generator->makeFlonum(1.2345678));
   ExactComplexNumberKev* exact_complex(generator->makeExactComplexNumber());
   exact_complex->set_real(*rational);
   exact_complex->set_imag(*rational);
@@ -106,3 +109,491 @@ void TestCode::Code03::write(KevcGenerator* generator) {
   generator->exportBind("my-code", fp);
   generator->writeToFile();
 }
+
+// A benchmark of tail calls, which is the same as
+// (let loop ((i 0)) (if (= i 100000000) i (loop (+ i 1))))
+void TestCode::Code04::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_equal(generator->importBind("="));
+
+  KevesIterator self;
+  CodeKev* code_loop(generator->makeCode(22));
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(100000000);
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_R);
+    *iter++ = proc_equal;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(3); // next --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- next
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_ADD_FX);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    self = iter++; // loop itself
+    *iter++ = KevesFixnum(1);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+  *self = proc_loop;
+
+  CodeKev* code(generator->makeCode(8));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_HALT);
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->writeToFile();
+}
+
+// A benchmark of multiple values, which is the same as
+// (let loop ((i 0))
+//   (if (= i 10000000)
+//       i
+//       (loop (+ i (call-with-values (lambda () (values 1 0)) +)))))
+void TestCode::Code05::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_equal(generator->importBind("="));
+  KevesValue proc_cwv(generator->importBind("call-with-values"));
+  KevesValue proc_values(generator->importBind("values"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+
+  CodeKev* code_producer(generator->makeCode(9));
+  {
+    KevesIterator iter(code_producer->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    *iter++ = proc_values;
+    *iter++ = KevesFixnum(2);
+    Q_ASSERT(iter <= code_producer->end());
+  }
+
+  LambdaKev* proc_producer(generator->makeLambda(clsr, code_producer, 0));
+
+  KevesIterator self;
+  CodeKev* code_loop(generator->makeCode(29));
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(10000000);
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_R);
+    *iter++ = proc_equal;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(3); // next --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0); // <--- next
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_cwv;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_producer;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_ADD_FX); // <--- return
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    self = iter++; // loop itself
+    *iter++ = KevesFixnum(1);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+  *self = proc_loop;
+
+  CodeKev* code(generator->makeCode(8));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_HALT);
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->writeToFile();
+}
+
+// The same benchmark as Code04, but the loop reads its counter with the
+// local operand instructions instead of pushing it.
+void TestCode::Code06::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_equal(generator->importBind("="));
+
+  KevesIterator self;
+  CodeKev* code_loop(generator->makeCode(18));
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_NUM_EQ_FX_LOCAL_R);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(100000000);
+    *iter++ = proc_equal;
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R);
+    *iter++ = KevesFixnum(3); // next --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL); // <--- next
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    self = iter++; // loop itself
+    *iter++ = KevesFixnum(1);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+  *self = proc_loop;
+
+  CodeKev* code(generator->makeCode(8));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_HALT);
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->writeToFile();
+}
+
+// A benchmark of a comparison applied as a procedure, which is the same as
+// (let loop ((i 0)) (if (< i 10000000) (loop (+ i 1)) i))
+void TestCode::Code07::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_less_than(generator->importBind("<"));
+
+  KevesIterator self;
+  CodeKev* code_loop(generator->makeCode(23));
+  {
+    KevesIterator iter(code_loop->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(7); // return --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_less_than;
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(10000000);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_LAST_POP_TEST_R); // <--- return
+    *iter++ = KevesFixnum(7); // next --->
+    *iter++ = KevesInstruct(CMD_ADD_FX_LOCAL);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesFixnum(1);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_TAIL_APPLY_CONSTANT);
+    self = iter++; // loop itself
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL); // <--- next
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN);
+    Q_ASSERT(iter <= code_loop->end());
+  }
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+  LambdaKev* proc_loop(generator->makeLambda(clsr, code_loop, 0));
+  *self = proc_loop;
+
+  CodeKev* code(generator->makeCode(8));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_loop;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_HALT);
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->writeToFile();
+}
+
+// A test of call/ec, which is the same as
+// (list (call/ec (lambda (k) (+ 10 (k 2))))
+//       (call/ec (lambda (k) 3))
+//       (call/ec (lambda (k) (k)))
+//       (call/ec (lambda (k)
+//                  (dynamic-wind (lambda () 0) (lambda () (k 4)) (lambda () 0)))))
+// The result must be (2 3 <unspecified> 4).
+void TestCode::Code08::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_add(generator->importBind("+"));
+  KevesValue proc_call_ec(generator->importBind("call/ec"));
+  KevesValue proc_dynamic_wind(generator->importBind("dynamic-wind"));
+  KevesValue proc_list(generator->importBind("list"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+
+  // (lambda (k) (+ 10 (k 2)))
+  CodeKev* code_escape(generator->makeCode(17));
+  {
+    KevesIterator iter(code_escape->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(12); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_add;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(10);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // return2 --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(2);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_APPLY); // <--- return2
+    *iter++ = KevesInstruct(CMD_RETURN0); // <--- return1
+    Q_ASSERT(iter <= code_escape->end());
+  }
+
+  LambdaKev* proc_escape(generator->makeLambda(clsr, code_escape, 0));
+
+  // (lambda (k) 3)
+  CodeKev* code_return(generator->makeCode(4));
+  {
+    KevesIterator iter(code_return->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT);
+    *iter++ = KevesFixnum(3);
+    Q_ASSERT(iter <= code_return->end());
+  }
+
+  LambdaKev* proc_return(generator->makeLambda(clsr, code_return, 0));
+
+  // (lambda (k) (k))
+  CodeKev* code_no_value(generator->makeCode(8));
+  {
+    KevesIterator iter(code_no_value->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(3); // return --->
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_RETURN0); // <--- return
+    Q_ASSERT(iter <= code_no_value->end());
+  }
+
+  LambdaKev* proc_no_value(generator->makeLambda(clsr, code_no_value, 0));
+
+  // (lambda () 0)
+  CodeKev* code_thunk(generator->makeCode(4));
+  {
+    KevesIterator iter(code_thunk->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_RETURN_CONSTANT);
+    *iter++ = KevesFixnum(0);
+    Q_ASSERT(iter <= code_thunk->end());
+  }
+
+  LambdaKev* proc_thunk(generator->makeLambda(clsr, code_thunk, 0));
+
+  // (lambda (k) (dynamic-wind (lambda () 0) (lambda () (k 4)) (lambda () 0)))
+  CodeKev* code_wind(generator->makeCode(25));
+  {
+    KevesIterator iter(code_wind->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(20); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_dynamic_wind;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_thunk;
+    *iter++ = KevesInstruct(CMD_CLOSE_R);
+    *iter++ = KevesFixnum(9); // close --->
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // return2 --->
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = KevesFixnum(4);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_RETURN0); // <--- return2
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT); // <--- close
+    *iter++ = proc_thunk;
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_RETURN0); // <--- return1
+    Q_ASSERT(iter <= code_wind->end());
+  }
+
+  LambdaKev* proc_wind(generator->makeLambda(clsr, code_wind, 0));
+
+  CodeKev* code(generator->makeCode(34));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(31); // halt --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_list;
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // next1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_call_ec;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_escape;
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- next1
+    *iter++ = KevesFixnum(5); // next2 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_call_ec;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_return;
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- next2
+    *iter++ = KevesFixnum(5); // next3 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_call_ec;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_no_value;
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_FRAME_R); // <--- next3
+    *iter++ = KevesFixnum(5); // list --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_call_ec;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_wind;
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_APPLY); // <--- list
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
+
+// A test of an escape applied after control has left its extent through
+// another escape, which is the same as
+// ((call/ec (lambda (outer) (call/ec (lambda (inner) (outer inner))))) 5)
+// *inner* is never expired by a normal return, so this must raise an
+// assertion of an expired escape instead of returning to a dead frame.
+void TestCode::Code09::write(KevcGenerator* generator) {
+  if (!generator->setImportLibrary("rnrs", "base", 6)) return;
+  KevesValue proc_call_ec(generator->importBind("call/ec"));
+
+  LocalVarFrameKev* clsr(generator->makeLocalVarFrame(0, nullptr));
+
+  // (lambda (outer) (call/ec (lambda (inner) (outer inner))))
+  CodeKev* code_outer(generator->makeCode(21));
+  {
+    KevesIterator iter(code_outer->begin());
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(16); // return1 --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_call_ec;
+    *iter++ = KevesInstruct(CMD_CLOSE_R);
+    *iter++ = KevesFixnum(9); // close --->
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_CALL_LAMBDA);
+    *iter++ = KevesFixnum(1);
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // return2 --->
+    *iter++ = KevesInstruct(CMD_REFER_FREE0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_REFER_LOCAL0);
+    *iter++ = KevesFixnum(0);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_RETURN0); // <--- return2
+    *iter++ = KevesInstruct(CMD_APPLY); // <--- close
+    *iter++ = KevesInstruct(CMD_RETURN0); // <--- return1
+    Q_ASSERT(iter <= code_outer->end());
+  }
+
+  LambdaKev* proc_outer(generator->makeLambda(clsr, code_outer, 0));
+
+  CodeKev* code(generator->makeCode(13));
+  {
+    KevesIterator iter(code->begin());
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(10); // halt --->
+    *iter++ = KevesInstruct(CMD_FRAME_R);
+    *iter++ = KevesFixnum(5); // apply --->
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_call_ec;
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT);
+    *iter++ = proc_outer;
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_PUSH_CONSTANT); // <--- apply
+    *iter++ = KevesFixnum(5);
+    *iter++ = KevesInstruct(CMD_APPLY);
+    *iter++ = KevesInstruct(CMD_HALT); // <--- halt
+    Q_ASSERT(iter <= code->end());
+  }
+
+  generator->exportBind("my-code", code);
+  generator->exportBind("environment", generator->makeEnvironment(EMB_NULL));
+  generator->writeToFile();
+}
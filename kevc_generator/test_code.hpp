@@ -31,4 +31,28 @@ namespace TestCode {
   namespace Code03 {
     void write(KevcGenerator* generator);
   };
+
+  namespace Code04 {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Code05 {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Code06 {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Code07 {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Code08 {
+    void write(KevcGenerator* generator);
+  };
+
+  namespace Code09 {
+    void write(KevcGenerator* generator);
+  };
 };
@@ -6,7 +6,7 @@ TEMPLATE = app
 TARGET = 
 DEPENDPATH += .
 INCLUDEPATH += .
-LIBS += -lgmpxx -lgmp -L/usr/lib/keves/keves/base/
+LIBS += -lgmpxx -lgmp -lrt -L/usr/lib/keves/keves/base/
 QMAKE_CXXFLAGS += -std=c++11
 
 # Input
@@ -19,6 +19,8 @@ HEADERS += keves_builtin_values.hpp \
            keves_iterator.hpp \
            keves_library.hpp \
            keves_list.hpp \
+           keves_log.hpp \
+           keves_profile.hpp \
            keves_stack.hpp \
            keves_template.hpp \
            keves_textual_port.hpp \
@@ -46,6 +48,7 @@ HEADERS += keves_builtin_values.hpp \
            kev/wrapped.hpp \
            value/char.hpp \
            value/fixnum.hpp \
+           value/flonum.hpp \
            value/instruct.hpp
            
 
@@ -54,6 +57,8 @@ SOURCES += keves_builtin_values.cpp \
            keves_gc.cpp \
            keves_iterator.cpp \
            keves_library.cpp \
+           keves_log.cpp \
+           keves_profile.cpp \
            keves_stack.cpp \
            keves_template.cpp \
            keves_textual_port.cpp \
@@ -81,3 +86,5 @@ SOURCES += keves_builtin_values.cpp \
 
 CONFIG += debug
 # CONFIG += qt release
+# DEFINES += KEVES_TRACE
+# DEFINES += KEVES_LOG_MIN_LEVEL=KEVES_LOG_INFO
@@ -31,69 +31,19 @@
 #include "value/instruct.hpp"
 
 
-#define DEFINE_MESG_KEY(mesg) \
-  const char KevesBuiltinValues::mesg_ ## mesg[] = #mesg
-
-DEFINE_MESG_KEY(Req0);
-DEFINE_MESG_KEY(Req1Got0);
-DEFINE_MESG_KEY(Req1GotMore);
-DEFINE_MESG_KEY(Req1Or2Got0);
-DEFINE_MESG_KEY(Req1Or2GotMore);
-DEFINE_MESG_KEY(Req1OrMoreGot0);
-DEFINE_MESG_KEY(Req2Got0);
-DEFINE_MESG_KEY(Req2Got1);
-DEFINE_MESG_KEY(Req2GotMore);
-DEFINE_MESG_KEY(Req2OrMoreGot0);
-DEFINE_MESG_KEY(Req2OrMoreGot1);
-DEFINE_MESG_KEY(Req3Got0);
-DEFINE_MESG_KEY(Req3Got1);
-DEFINE_MESG_KEY(Req3Got2);
-DEFINE_MESG_KEY(Req3GotMore);
-DEFINE_MESG_KEY(ReqNotGet3Args);
-DEFINE_MESG_KEY(ReqMoreGotLess);
-DEFINE_MESG_KEY(ReqLessGotMore);
-DEFINE_MESG_KEY(ReqNum);
-DEFINE_MESG_KEY(ReqRealNum);
-DEFINE_MESG_KEY(ReqRealNumAs1st);
-DEFINE_MESG_KEY(ReqRealNumAs2nd);
-DEFINE_MESG_KEY(ReqIntNum);
-DEFINE_MESG_KEY(ReqIntNumAs1st);
-DEFINE_MESG_KEY(ReqIntNumAs2nd);
-DEFINE_MESG_KEY(ReqIntNumAs3rd);
-DEFINE_MESG_KEY(ReqChar);
-DEFINE_MESG_KEY(ReqCharAs1st);
-DEFINE_MESG_KEY(ReqCharAs2nd);
-DEFINE_MESG_KEY(ReqStr);
-DEFINE_MESG_KEY(ReqStrAs1st);
-DEFINE_MESG_KEY(ReqSym);
-DEFINE_MESG_KEY(ReqPair);
-DEFINE_MESG_KEY(ReqListAsLast);
-DEFINE_MESG_KEY(ReqProperList);
-DEFINE_MESG_KEY(ReqVector);
-DEFINE_MESG_KEY(ReqVectorAs1st);
-DEFINE_MESG_KEY(ReqProc);
-DEFINE_MESG_KEY(ReqProcAs1st);
-DEFINE_MESG_KEY(ReqProcAs2nd);
-DEFINE_MESG_KEY(ReqProcAs3rd);
-DEFINE_MESG_KEY(1stObjNotProcOrSyn);
-DEFINE_MESG_KEY(OutOfRange);
-DEFINE_MESG_KEY(Div0);
-
-#undef DEFINE_MESG_KEY
-
-
 KevesBuiltinValues::KevesBuiltinValues()
   : mesg_text_(),
+    mesg_table_(),
     sym_eval_(),
     builtin_code_(),
     code_APPLY_(),
     code_HALT_(),
     code_REMOVE_DYNAMIC_WIND_(),
-    code_REVERT_DYNAMIC_WIND_and_APPLY_(),
     code_POP_APPLY_(),
     code_POP_RETURN_(),
     code_SET_DYNAMIC_WIND_(),
     code_APPLY_MULT_APPLY_(),
+    code_EXPIRE_ESCAPE_(),
     amp_assert_("&assert"),
     amp_lexical_("&lexical"),
     amp_irritants_("&irritants"),
@@ -103,10 +53,11 @@ KevesBuiltinValues::KevesBuiltinValues()
 
 void KevesBuiltinValues::init(KevesCommon* common) {
   initMesgList("conf/mesg_text.csv", common);
+  initMesgTable();
 
   sym_eval_ = SymbolKev::make(common, "eval");
 
-  builtin_code_ = CodeKev::make(common, 11);
+  builtin_code_ = CodeKev::make(common, 10);
   {
     KevesIterator iter(builtin_code_->begin());
     code_HALT_ = iter;
@@ -118,9 +69,6 @@ void KevesBuiltinValues::init(KevesCommon* common) {
     code_POP_RETURN_ = iter;
     *iter++ = KevesInstruct(CMD_POP);
     *iter++ = KevesInstruct(CMD_RETURN);
-    code_REVERT_DYNAMIC_WIND_and_APPLY_ = iter;
-    *iter++ = KevesInstruct(CMD_REVERT_DYNAMIC_WIND);
-    *iter++ = KevesInstruct(CMD_APPLY);
     code_REMOVE_DYNAMIC_WIND_ = iter;
     *iter++ = KevesInstruct(CMD_REMOVE_DYNAMIC_WIND);
     code_SET_DYNAMIC_WIND_ = iter;
@@ -128,6 +76,8 @@ void KevesBuiltinValues::init(KevesCommon* common) {
     code_APPLY_MULT_APPLY_ = iter;
     *iter++ = KevesInstruct(CMD_APPLY_MULT);
     *iter++ = KevesInstruct(CMD_APPLY);
+    code_EXPIRE_ESCAPE_ = iter;
+    *iter++ = KevesInstruct(CMD_EXPIRE_ESCAPE);
     Q_ASSERT(iter <= builtin_code_->end());
   }
 }
@@ -179,6 +129,60 @@ void KevesBuiltinValues::initMesgList(const QString& file_name,
   mesg_file.close();
 }
 
+// resolve message ids at init, so that raising an assertion does not
+// need to look up the hash with a string
+void KevesBuiltinValues::initMesgTable() {
+#define SET_MESG_TO_TABLE(mesg) mesg_table_[mesg_ ## mesg] = getMesgText(#mesg)
+
+  SET_MESG_TO_TABLE(Req0);
+  SET_MESG_TO_TABLE(Req1Got0);
+  SET_MESG_TO_TABLE(Req1GotMore);
+  SET_MESG_TO_TABLE(Req1Or2Got0);
+  SET_MESG_TO_TABLE(Req1Or2GotMore);
+  SET_MESG_TO_TABLE(Req1OrMoreGot0);
+  SET_MESG_TO_TABLE(Req2Got0);
+  SET_MESG_TO_TABLE(Req2Got1);
+  SET_MESG_TO_TABLE(Req2GotMore);
+  SET_MESG_TO_TABLE(Req2OrMoreGot0);
+  SET_MESG_TO_TABLE(Req2OrMoreGot1);
+  SET_MESG_TO_TABLE(Req3Got0);
+  SET_MESG_TO_TABLE(Req3Got1);
+  SET_MESG_TO_TABLE(Req3Got2);
+  SET_MESG_TO_TABLE(Req3GotMore);
+  SET_MESG_TO_TABLE(ReqNotGet3Args);
+  SET_MESG_TO_TABLE(ReqMoreGotLess);
+  SET_MESG_TO_TABLE(ReqLessGotMore);
+  SET_MESG_TO_TABLE(ReqNum);
+  SET_MESG_TO_TABLE(ReqRealNum);
+  SET_MESG_TO_TABLE(ReqRealNumAs1st);
+  SET_MESG_TO_TABLE(ReqRealNumAs2nd);
+  SET_MESG_TO_TABLE(ReqIntNum);
+  SET_MESG_TO_TABLE(ReqIntNumAs1st);
+  SET_MESG_TO_TABLE(ReqIntNumAs2nd);
+  SET_MESG_TO_TABLE(ReqIntNumAs3rd);
+  SET_MESG_TO_TABLE(ReqChar);
+  SET_MESG_TO_TABLE(ReqCharAs1st);
+  SET_MESG_TO_TABLE(ReqCharAs2nd);
+  SET_MESG_TO_TABLE(ReqStr);
+  SET_MESG_TO_TABLE(ReqStrAs1st);
+  SET_MESG_TO_TABLE(ReqSym);
+  SET_MESG_TO_TABLE(ReqPair);
+  SET_MESG_TO_TABLE(ReqListAsLast);
+  SET_MESG_TO_TABLE(ReqProperList);
+  SET_MESG_TO_TABLE(ReqVector);
+  SET_MESG_TO_TABLE(ReqVectorAs1st);
+  SET_MESG_TO_TABLE(ReqProc);
+  SET_MESG_TO_TABLE(ReqProcAs1st);
+  SET_MESG_TO_TABLE(ReqProcAs2nd);
+  SET_MESG_TO_TABLE(ReqProcAs3rd);
+  SET_MESG_TO_TABLE(1stObjNotProcOrSyn);
+  SET_MESG_TO_TABLE(OutOfRange);
+  SET_MESG_TO_TABLE(Div0);
+  SET_MESG_TO_TABLE(EscapeExpired);
+
+#undef SET_MESG_TO_TABLE
+}
+
 const StringKev* KevesBuiltinValues::getMesgText(const QString& key) const {
   return mesg_text_.value(key);
 }
@@ -43,53 +43,61 @@ public:
   void init(KevesCommon* common);
 
   // for messages
-  static const char mesg_Req0[];
-  static const char mesg_Req1Got0[];
-  static const char mesg_Req1GotMore[];
-  static const char mesg_Req1Or2Got0[];
-  static const char mesg_Req1Or2GotMore[];
-  static const char mesg_Req1OrMoreGot0[];
-  static const char mesg_Req2Got0[];
-  static const char mesg_Req2Got1[];
-  static const char mesg_Req2GotMore[];
-  static const char mesg_Req2OrMoreGot0[];
-  static const char mesg_Req2OrMoreGot1[];
-  static const char mesg_Req3Got0[];
-  static const char mesg_Req3Got1[];
-  static const char mesg_Req3Got2[];
-  static const char mesg_Req3GotMore[];
-  static const char mesg_ReqNotGet3Args[];
-  static const char mesg_ReqMoreGotLess[];
-  static const char mesg_ReqLessGotMore[];
-  static const char mesg_ReqNum[];
-  static const char mesg_ReqRealNum[];
-  static const char mesg_ReqRealNumAs1st[];
-  static const char mesg_ReqRealNumAs2nd[];
-  static const char mesg_ReqIntNum[];
-  static const char mesg_ReqIntNumAs1st[];
-  static const char mesg_ReqIntNumAs2nd[];
-  static const char mesg_ReqIntNumAs3rd[];
-  static const char mesg_ReqChar[];
-  static const char mesg_ReqCharAs1st[];
-  static const char mesg_ReqCharAs2nd[];
-  static const char mesg_ReqStr[];
-  static const char mesg_ReqStrAs1st[];
-  static const char mesg_ReqSym[];
-  static const char mesg_ReqPair[];
-  static const char mesg_ReqListAsLast[];
-  static const char mesg_ReqProperList[];
-  static const char mesg_ReqVector[];
-  static const char mesg_ReqVectorAs1st[];
-  static const char mesg_ReqProc[];
-  static const char mesg_ReqProcAs1st[];
-  static const char mesg_ReqProcAs2nd[];
-  static const char mesg_ReqProcAs3rd[];
-  static const char mesg_1stObjNotProcOrSyn[];
-  static const char mesg_OutOfRange[];
-  static const char mesg_Div0[];
+  enum mesg_id {
+    mesg_Req0,
+    mesg_Req1Got0,
+    mesg_Req1GotMore,
+    mesg_Req1Or2Got0,
+    mesg_Req1Or2GotMore,
+    mesg_Req1OrMoreGot0,
+    mesg_Req2Got0,
+    mesg_Req2Got1,
+    mesg_Req2GotMore,
+    mesg_Req2OrMoreGot0,
+    mesg_Req2OrMoreGot1,
+    mesg_Req3Got0,
+    mesg_Req3Got1,
+    mesg_Req3Got2,
+    mesg_Req3GotMore,
+    mesg_ReqNotGet3Args,
+    mesg_ReqMoreGotLess,
+    mesg_ReqLessGotMore,
+    mesg_ReqNum,
+    mesg_ReqRealNum,
+    mesg_ReqRealNumAs1st,
+    mesg_ReqRealNumAs2nd,
+    mesg_ReqIntNum,
+    mesg_ReqIntNumAs1st,
+    mesg_ReqIntNumAs2nd,
+    mesg_ReqIntNumAs3rd,
+    mesg_ReqChar,
+    mesg_ReqCharAs1st,
+    mesg_ReqCharAs2nd,
+    mesg_ReqStr,
+    mesg_ReqStrAs1st,
+    mesg_ReqSym,
+    mesg_ReqPair,
+    mesg_ReqListAsLast,
+    mesg_ReqProperList,
+    mesg_ReqVector,
+    mesg_ReqVectorAs1st,
+    mesg_ReqProc,
+    mesg_ReqProcAs1st,
+    mesg_ReqProcAs2nd,
+    mesg_ReqProcAs3rd,
+    mesg_1stObjNotProcOrSyn,
+    mesg_OutOfRange,
+    mesg_Div0,
+    mesg_EscapeExpired,
+    MESG_ID_SIZE
+  };
 
   const StringKev* getMesgText(const QString& key) const;
 
+  const StringKev* getMesgText(mesg_id id) const {
+    return mesg_table_[id];
+  }
+
   SymbolKev* sym_eval() {
     return sym_eval_;
   }
@@ -107,10 +115,6 @@ public:
     return code_REMOVE_DYNAMIC_WIND_;
   }
   
-  const_KevesIterator code_REVERT_DYNAMIC_WIND_and_APPLY() const {
-    return code_REVERT_DYNAMIC_WIND_and_APPLY_;
-  }
-  
   const_KevesIterator code_POP_APPLY() const {
     return code_POP_APPLY_;
   }
@@ -127,6 +131,10 @@ public:
     return code_APPLY_MULT_APPLY_;
   }
 
+  const_KevesIterator code_EXPIRE_ESCAPE() const {
+    return code_EXPIRE_ESCAPE_;
+  }
+
   const RecordKev* amp_assert() const {
     return &amp_assert_;
   }
@@ -154,18 +162,20 @@ public:
 
 private:
   void initMesgList(const QString& file_name, KevesCommon* common);
+  void initMesgTable();
 
   QHash<QString, const StringKev*> mesg_text_;
+  const StringKev* mesg_table_[MESG_ID_SIZE];
   SymbolKev* sym_eval_;
   CodeKev* builtin_code_;
   const_KevesIterator code_APPLY_;
   const_KevesIterator code_HALT_;
   const_KevesIterator code_REMOVE_DYNAMIC_WIND_;
-  const_KevesIterator code_REVERT_DYNAMIC_WIND_and_APPLY_;
   const_KevesIterator code_POP_APPLY_;
   const_KevesIterator code_POP_RETURN_;
   const_KevesIterator code_SET_DYNAMIC_WIND_;
   const_KevesIterator code_APPLY_MULT_APPLY_;
+  const_KevesIterator code_EXPIRE_ESCAPE_;
 
   RecordKev amp_assert_;
   RecordKev amp_lexical_;
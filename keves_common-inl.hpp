@@ -20,6 +20,7 @@
 #pragma once
 
 #include <QDataStream>
+#include "value/fixnum.hpp"
   
 
 template<class KEV>
@@ -53,6 +54,43 @@ void KevesCommon::readArray(QDataStream& in, KEV* kev) {
   }
 }
 
+template<class KEV>
+void KevesCommon::readCode(QDataStream& in, KEV* kev) {
+  KevesValue* iter(kev->array());
+  const KevesValue* end(iter + kev->size());
+  quint8 lead;
+
+  for (; iter != end; ++iter) {
+    in >> lead;
+
+    switch (lead) {
+    case CODE_FIXNUM: {
+      uioword zigzag(readVarint(in));
+      *iter = KevesFixnum(static_cast<fx_int>((zigzag >> 1) ^ (0 - (zigzag & 1))));
+      break;
+    }
+
+    case CODE_INDEX:
+      *iter = KevesValue::fromUioword<Kev>(readVarint(in) << 2 | INDEX);
+      break;
+
+    case CODE_INSTRUCT:
+      *iter = KevesInstruct(static_cast<keves_instruct>(readVarint(in)));
+      break;
+
+    case CODE_RAW: {
+      uioword value;
+      in >> value;
+      *iter = KevesValue::fromUioword<Kev>(value);
+      break;
+    }
+
+    default:
+      *iter = KevesInstruct(static_cast<keves_instruct>(lead));
+    }
+  }
+}
+
 template<class KEV>
 void KevesCommon::revertArray(const QList<const Kev*>& object_list, KEV* kev) {
   KevesValue* iter(kev->array());
@@ -71,6 +109,43 @@ void KevesCommon::writeArray(const QList<const Kev*>& list,
   for (; iter != end; ++iter) out << indexAddress(list, *iter);
 }
 
+template<class KEV>
+void KevesCommon::writeCode(const QList<const Kev*>& list,
+			    QDataStream& out,
+			    KEV* kev) {
+  const KevesValue* iter(kev->array());
+  const KevesValue* end(iter + kev->size());
+
+  for (; iter != end; ++iter) {
+    KevesValue value(*iter);
+
+    if (value.isInstruct()) {
+      int inst(static_cast<keves_instruct>(KevesInstruct(value)));
+
+      if (inst < CODE_FIXNUM) {
+	out << static_cast<quint8>(inst);
+      } else {
+	out << static_cast<quint8>(CODE_INSTRUCT);
+	writeVarint(out, inst);
+      }
+    } else if (value.isFixnum()) {
+      KevesFixnum fixnum(value);
+      ioword num(fixnum);
+      out << static_cast<quint8>(CODE_FIXNUM);
+      writeVarint(out, static_cast<uioword>(num) << 1 ^ static_cast<uioword>(num >> 63));
+    } else {
+      uioword word(indexAddress(list, value));
+
+      if (value.isPtr() && (word & ALIGN) == INDEX) {
+	out << static_cast<quint8>(CODE_INDEX);
+	writeVarint(out, word >> 2);
+      } else {
+	out << static_cast<quint8>(CODE_RAW) << word;
+      }
+    }
+  }
+}
+
 template<class KEV>
 void KevesCommon::setFunctionTable() {
   ft_PushChildren_[KEV::TYPE]
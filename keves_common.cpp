@@ -21,9 +21,12 @@
 #include "keves_common-inl.hpp"
 
 #include <iostream>
+#include <limits>
 #include <QLibrary>
 #include <QMutexLocker>
 #include "keves_library.hpp"
+#include "keves_log.hpp"
+#include "keves_profile.hpp"
 #include "keves_vm.hpp"
 #include "kev/bignum.hpp"
 #include "kev/bignum-inl.hpp"
@@ -68,7 +71,11 @@ KevesCommon::KevesCommon()
     ft_RevertObject_(),
     ft_ReadObject_(),
     ft_WriteObject_(),
-    mutex_(QMutex::Recursive) {
+    mutex_(QMutex::Recursive),
+    timeline_(nullptr) {
+  QByteArray timeline(qgetenv("KEVES_TIMELINE"));
+  if (!timeline.isEmpty()) timeline_ = new KevesTimeline(QString(timeline));
+
   initCMDTable();
   initLibraryList();
   builtin_.init(this);
@@ -89,6 +96,7 @@ KevesCommon::KevesCommon()
   setFunctionTable<RecordKev>();
   setFunctionTable<SimpleConditionKev>();
   setFunctionTable<CompoundConditionKev>();
+  setFunctionTable<AssertConditionKev>();
   setFunctionTable<LambdaKev>();
   setFunctionTable<ArgumentFrameKev>();
   setFunctionTable<LocalVarFrameKev>();
@@ -101,10 +109,66 @@ KevesCommon::KevesCommon()
 KevesCommon::~KevesCommon() {
   thread_pool_.waitForDone();
   for (auto library : library_list_) delete library;
+
+  if (timeline_) {
+    timeline_->write();
+    delete timeline_;
+  }
 }
 
 void KevesCommon::runThread(KevesValue arg) {
   KevesVM* vm(KevesVM::make(this, default_result_field()));
+  QByteArray profile(qgetenv("KEVES_PROFILE"));
+
+  if (!profile.isEmpty()) {
+    // KEVES_PROFILE_FORMAT=json writes JSON in place of CSV
+    bool json(qgetenv("KEVES_PROFILE_FORMAT") == "json");
+    vm->startProfile(QString("%1.%2.%3")
+		     .arg(QString(profile))
+		     .arg(reinterpret_cast<quintptr>(vm), 0, 16)
+		     .arg(json ? "json" : "csv"));
+  }
+
+  QByteArray sample(qgetenv("KEVES_SAMPLE"));
+
+  if (!sample.isEmpty()) {
+    vm->startSampling(QString("%1.%2.folded")
+		      .arg(QString(sample))
+		      .arg(reinterpret_cast<quintptr>(vm), 0, 16),
+		      100);
+  }
+
+  QByteArray calls(qgetenv("KEVES_CALLS"));
+
+  if (!calls.isEmpty()) {
+    vm->startCallProfile(QString("%1.%2.csv")
+			 .arg(QString(calls))
+			 .arg(reinterpret_cast<quintptr>(vm), 0, 16));
+  }
+
+  if (timeline_) vm->startTimeline(timeline_);
+  if (!qgetenv("KEVES_PERF").isEmpty()) vm->startPerfCounters();
+
+  QByteArray alloc(qgetenv("KEVES_ALLOC"));
+
+  if (!alloc.isEmpty()) {
+    vm->startAllocProfile(QString("%1.%2.txt")
+			  .arg(QString(alloc))
+			  .arg(reinterpret_cast<quintptr>(vm), 0, 16));
+  }
+
+  QByteArray hot_code(qgetenv("KEVES_HOT_CODE"));
+
+  if (!hot_code.isEmpty()) {
+    vm->startCodeCounters(QString("%1.%2.csv")
+			  .arg(QString(hot_code))
+			  .arg(reinterpret_cast<quintptr>(vm), 0, 16));
+  }
+
+#ifdef KEVES_TRACE
+  if (!qgetenv("KEVES_TRACE").isEmpty()) vm->startTrace();
+#endif
+
   vm->acc_ = arg;
   thread_pool_.start(vm);
 }
@@ -132,10 +196,15 @@ void KevesCommon::initCMDTable() {
   SET_FUNCTION_TO_TABLE(SWITCH_N_ARG_R);
   SET_FUNCTION_TO_TABLE(FRAME);
   SET_FUNCTION_TO_TABLE(FRAME_R);
+  SET_FUNCTION_TO_TABLE(FRAME_N_R);
   SET_FUNCTION_TO_TABLE(SFRAME);
   SET_FUNCTION_TO_TABLE(APPLY);
   SET_FUNCTION_TO_TABLE(APPLY_CONSTANT);
   SET_FUNCTION_TO_TABLE(APPLY_MULT);
+  SET_FUNCTION_TO_TABLE(TAIL_APPLY);
+  SET_FUNCTION_TO_TABLE(TAIL_APPLY_CONSTANT);
+  SET_FUNCTION_TO_TABLE(APPLY_LAMBDA);
+  SET_FUNCTION_TO_TABLE(TAIL_APPLY_LAMBDA);
   SET_FUNCTION_TO_TABLE(RETURN);
   SET_FUNCTION_TO_TABLE(RETURN_CONSTANT);
   SET_FUNCTION_TO_TABLE(RETURN0);
@@ -181,6 +250,17 @@ void KevesCommon::initCMDTable() {
 
   SET_FUNCTION_TO_TABLE(TEST_NUMBER_EQUAL_R);
 
+  // for fixnums
+  SET_FUNCTION_TO_TABLE(ADD_FX);
+  SET_FUNCTION_TO_TABLE(SUB_FX);
+  SET_FUNCTION_TO_TABLE(LT_FX_R);
+  SET_FUNCTION_TO_TABLE(NUM_EQ_FX_R);
+  SET_FUNCTION_TO_TABLE(ADD_FX_LOCAL);
+  SET_FUNCTION_TO_TABLE(SUB_FX_LOCAL);
+  SET_FUNCTION_TO_TABLE(LT_FX_LOCAL_R);
+  SET_FUNCTION_TO_TABLE(NUM_EQ_FX_LOCAL_R);
+  CHECK_SUM(NUM_EQ_FX_LOCAL_R);
+
   // for char
   SET_FUNCTION_TO_TABLE(TEST_CHAR_R);
   SET_FUNCTION_TO_TABLE(TEST_CHAR0_R);
@@ -213,7 +293,7 @@ void KevesCommon::initCMDTable() {
 
   // for call/cc
   SET_FUNCTION_TO_TABLE(UNWIND_CONTINUATION);
-  SET_FUNCTION_TO_TABLE(REVERT_DYNAMIC_WIND);
+  SET_FUNCTION_TO_TABLE(EXPIRE_ESCAPE);
 
   // for dynamic-wind
   SET_FUNCTION_TO_TABLE(SET_DYNAMIC_WIND);
@@ -309,6 +389,11 @@ void KevesCommon::appendObjectList(QList<const Kev*>* list, const Kev* kev) {
   }
 }
       
+QList<KevesLibrary*> KevesCommon::libraries() {
+  QMutexLocker locker(&mutex_);
+  return library_list_;
+}
+
 void KevesCommon::addLibrary(KevesLibrary* library) {
   library_list_.append(library);
 }
@@ -328,12 +413,23 @@ KevesLibrary* KevesCommon::getLibrary(const QStringList& id,
 				      const QList<ver_num_t>& ver_num) {
   Q_ASSERT(id.size() > 0);
 
+  double begin(timeline_ ? timeline_->now() : 0.0);
   QMutexLocker locker(&mutex_);
+  if (timeline_) timeline_->addSpan("wait for library", "library", begin, timeline_->now());
   
   for (auto lib : library_list_)
     if (lib->match(id)) return lib;
 
-  return loadLibrary(id, ver_num);
+  if (!timeline_) return loadLibrary(id, ver_num);
+
+  begin = timeline_->now();
+  KevesLibrary* library(loadLibrary(id, ver_num));
+
+  timeline_->addSpan(QString("load %1")
+		     .arg(KevesLibrary::makeFullName(id, ver_num)),
+		     "library", begin, timeline_->now());
+
+  return library;
 }
 
 KevesLibrary* KevesCommon::loadLibrary(const QStringList& id,
@@ -374,7 +470,7 @@ KevesLibrary* KevesCommon::loadCompiledLibrary(const QStringList& id,
 
   if (!file.exists()) return nullptr;
 
-  std::cout << "find library: " << qPrintable(file_name) << std::endl;
+  KEVES_LOG(KEVES_LOG_INFO) << "find library: " << qPrintable(file_name);
   KevesLibrary* library(KevesLibrary::readFromFile(file_name, this));
   addLibrary(library);
   return library;
@@ -393,6 +489,7 @@ void KevesCommon::pushToSharedList(MutableKev* kev) {
 
 uioword KevesCommon::indexAddress(const QList<const Kev*>& table,
 				  KevesValue value) {
+  value = FlonumKev::canonicalize(value);
   if (!value.isPtr()) return value.toUIntPtr();
   
   int index(table.indexOf(value.toPtr()));
@@ -401,7 +498,35 @@ uioword KevesCommon::indexAddress(const QList<const Kev*>& table,
     value.toUIntPtr() : (static_cast<quintptr>(index) << 2 | INDEX);
 }
 
+uioword KevesCommon::readVarint(QDataStream& in) {
+  uioword value(0);
+  quint8 byte;
+  int shift(0);
+
+  do {
+    // a varint longer than uioword can only come from a broken file
+    if (shift >= std::numeric_limits<uioword>::digits) {
+      in.setStatus(QDataStream::ReadCorruptData);
+      return 0;
+    }
+
+    in >> byte;
+    value |= static_cast<uioword>(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+
+  return value;
+}
+
+void KevesCommon::writeVarint(QDataStream& out, uioword value) {
+  for (; value >= 0x80; value >>= 7)
+    out << static_cast<quint8>(value | 0x80);
+
+  out << static_cast<quint8>(value);
+}
+
 void KevesCommon::pushValue(QStack<const Kev*>* pending, KevesValue value) {
+  value = FlonumKev::canonicalize(value);
   if (value.isPtr()) pending->push(value.toPtr());
 }
 
@@ -414,7 +539,8 @@ void KevesCommon::revertObjects(const QList<const Kev*>& object_list, int start_
 
 void KevesCommon::revertValue(const QList<const Kev*>& object_list,
 			      KevesValue* value) {
-  if (isIndex(*value)) *value = object_list.at(value->toUIntPtr() >> 2);
+  if (isIndex(*value))
+    *value = FlonumKev::canonicalize(object_list.at(value->toUIntPtr() >> 2));
 }
 
 QString KevesCommon::toString(KevesValue value) const {
@@ -533,6 +659,8 @@ void KevesCommon::toString_element(QString* str, KevesValue value) const {
   } else if (value.isFixnum()) {
     KevesFixnum num(value);
     str->append(QString::number(num));
+  } else if (value.isFlonum()) {
+    str->append(FlonumKev::fromKevesValue(value).toQString(false, 32));
   } else if (value.isChar()) {
     KevesChar chr(value);
     str->append("#\\").append(chr);
@@ -660,6 +788,10 @@ void KevesCommon::toString_element(QString* str, KevesValue value) const {
       str->append("<procedure: continuation>");
       break;
       
+    case ESCAPE:
+      str->append("<procedure: escape>");
+      break;
+      
     case ENVIRONMENT:
       str->append("<environment>");
       break;
@@ -31,6 +31,7 @@
 
 class KevesLibrary;
 class KevesImportLibraryList;
+class KevesTimeline;
 class QString;
 
 
@@ -53,6 +54,11 @@ public:
 			   const QList<ver_num_t>& ver_num);
 
   const StringKev* getMesgText(const QString& key) const;
+
+  const StringKev* getMesgText(KevesBuiltinValues::mesg_id id) const {
+    return builtin_.getMesgText(id);
+  }
+
   KevesValue makeAssertCondition(KevesValue a, KevesValue b, KevesValue c);
 
   void runThread(KevesValue arg);
@@ -78,6 +84,8 @@ public:
     return &instruct_table_;
   }
 
+  QList<KevesLibrary*> libraries();
+
   static bool match(const QStringList& list1, const QStringList& list2);
 
 private:
@@ -102,6 +110,16 @@ private:
 public:
   enum { ALIGN = 0x3, INDEX = 0x2 };
 
+  // In a .kevc file, an instruction of code is written in one byte, and
+  // the other words are written after one of these bytes. It makes files
+  // smaller, not code in memory.
+  enum {
+    CODE_FIXNUM = 0xf0, // a zigzag varint follows
+    CODE_INDEX, // a varint index of the object list follows
+    CODE_INSTRUCT, // a varint instruction over 0xef follows
+    CODE_RAW // an uioword follows
+  };
+
   void appendObjectList(QList<const Kev*>* list, const Kev* kev);
 
   static uioword indexAddress(const QList<const Kev*>& object_list,
@@ -110,6 +128,11 @@ public:
   template<class KEV>
   static void readArray(QDataStream& in, KEV* kev);
 
+  template<class KEV>
+  static void readCode(QDataStream& in, KEV* kev);
+
+  static uioword readVarint(QDataStream& in);
+
   template<class KEV>
   static void revertArray(const QList<const Kev*>& object_list, KEV* kev);
   
@@ -131,6 +154,11 @@ public:
   template<class KEV>
   static void writeArray(const QList<const Kev*>& list, QDataStream& out, KEV* kev);
 
+  template<class KEV>
+  static void writeCode(const QList<const Kev*>& list, QDataStream& out, KEV* kev);
+
+  static void writeVarint(QDataStream& out, uioword value);
+
   Kev* (*ft_readObject(uioword value))(QDataStream&, KevesCommon*) {
     return ft_ReadObject_[value];
   }
@@ -193,4 +221,5 @@ private:
 				KevesValue);
 
   QMutex mutex_;
+  KevesTimeline* timeline_;
 };
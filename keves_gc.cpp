@@ -19,7 +19,10 @@
 #include "keves_gc.hpp"
 #include "keves_gc-inl.hpp"
 
-#include <iostream>
+#include <QElapsedTimer>
+
+#include "keves_log.hpp"
+#include "keves_profile.hpp"
 #include "keves_vm.hpp"
 #include "kev/bignum.hpp"
 #include "kev/code.hpp"
@@ -44,6 +47,19 @@ void KevesGC::init(KevesVM* vm, KevesList<KevesNode<0> >* shared_list) {
   gr1_ = &vm->gr1_;
   gr2_ = &vm->gr2_;
   gr3_ = &vm->gr3_;
+  vals_ = vm->vals_;
+  valn_ = &vm->valn_;
+  keves_vals_ = &vm->keves_vals_;
+  elapsed_time_ = 0;
+  allocated_bytes_ = 0;
+  promoted_bytes_ = 0;
+  collections_ = 0;
+  collecting_ = false;
+  alloc_profile_ = nullptr;
+  code_counters_ = nullptr;
+  timeline_ = nullptr;
+  perf_counters_ = nullptr;
+  pause_log_ = nullptr;
 
   shared_list_ = shared_list;
 
@@ -62,7 +78,9 @@ void KevesGC::init(KevesVM* vm, KevesList<KevesNode<0> >* shared_list) {
   setFunctionTable<RecordKev>();
   setFunctionTable<SimpleConditionKev>();
   setFunctionTable<CompoundConditionKev>();
+  setFunctionTable<AssertConditionKev>();
   setFunctionTable<LambdaKev>();
+  setFunctionTable<EscapeKev>();
   setFunctionTable<ArgumentFrameKev>();
   setFunctionTable<LocalVarFrameKev>();
   // setFunctionTable<FreeVarFrameKev>();
@@ -92,7 +110,9 @@ KevesGC::Tenured::Tenured()
   setFunctionTable<RecordKev>();
   setFunctionTable<SimpleConditionKev>();
   setFunctionTable<CompoundConditionKev>();
+  setFunctionTable<AssertConditionKev>();
   setFunctionTable<LambdaKev>();
+  setFunctionTable<EscapeKev>();
   setFunctionTable<ArgumentFrameKev>();
   setFunctionTable<LocalVarFrameKev>();
   // setFunctionTable<FreeVarFrameKev>();
@@ -124,6 +144,9 @@ void KevesGC::reset() {
   unchecked_list_.clear();
   // count_of_mark_and_sweep_ = 0;
   elapsed_time_ = 0;
+  allocated_bytes_ = 0;
+  promoted_bytes_ = 0;
+  collections_ = 0;
 }
 
 size_t KevesGC::alignedSize(size_t size) {
@@ -133,6 +156,9 @@ size_t KevesGC::alignedSize(size_t size) {
 }
 
 void* KevesGC::Tenured::Alloc(size_t alloc_size) {
+  gc_->allocated_bytes_ += alloc_size;
+  if (gc_->collecting_) gc_->promoted_bytes_ += alloc_size;
+
   if (alloc_size < MAX_RECYCLE_SIZE && !gc_->free_list_[alloc_size].isEmpty()) {
     KevesNode<0> node(gc_->free_list_[alloc_size].Pop());
     gc_->tenured_list_.push(node);
@@ -142,7 +168,7 @@ void* KevesGC::Tenured::Alloc(size_t alloc_size) {
   KevesBaseNode node(new char[alignedSize(alloc_size) + sizeof(KevesPrefix)]);
   
   if (node.isEmpty()) {
-    std::cout << "Tenured is full!!!" << std::endl;
+    KEVES_LOG(KEVES_LOG_ERROR) << "Tenured is full!!!";
     longjmp(*gc_->jmp_exit_, -2);
   }
   
@@ -150,6 +176,22 @@ void* KevesGC::Tenured::Alloc(size_t alloc_size) {
   return node.toPtr();
 }
 
+void KevesGC::endPhase(const char* name, int phase, double* begin) {
+  if (timeline_) {
+    double end(timeline_->now());
+    timeline_->addSpan(name, "gc", *begin, end);
+    *begin = end;
+  }
+
+  if (perf_counters_)
+    perf_counters_->endPhase(static_cast<KevesPerfCounters::phase>(phase));
+}
+
+// Objects made while collecting are promoted from eden.
+void KevesGC::profileAllocation(const MutableKev* kev, size_t size) {
+  alloc_profile_->allocate(kev->type(), size, collecting_);
+}
+
 void KevesGC::pushToUncheckedList(MutableKev* kev) {
   unchecked_list_.push(kev);
 }
@@ -167,6 +209,12 @@ void KevesGC::markLive(MutableKev* kev) {
   if (isInTenuredWithoutMark(kev)) pushToMarkedList(kev);
 }
 
+MutableKev* KevesGC::survivor(MutableKev* kev) const {
+  if (kev->isCopied()) return kev->getNewAddress();
+  if (isInEden(kev)) return nullptr;
+  return isInTenuredWithoutMark(kev) ? nullptr : kev;
+}
+
 void KevesGC::pushToFreeList(KevesBaseNode node) {
   MutableKevesValue kev(node->isCopied() ? node->getNewAddress() : node.toKev());
   size_t size(ft_size_[kev.type()](kev.toPtr()));
@@ -186,8 +234,14 @@ bool KevesGC::isInTenuredWithoutMark(MutableKev* kev) const {
 }
 
 void KevesGC::execute(const_KevesIterator pc) {
-  clock_t start_time(clock());
+  // a pause is wall time, which clock() of the process CPU time is not
+  QElapsedTimer timer;
+  timer.start();
   pc_ = pc;
+  collecting_ = true;
+  double gc_begin(timeline_ ? timeline_->now() : 0.0);
+  double phase_begin(gc_begin);
+  if (perf_counters_) perf_counters_->beginPhase();
 
   unmarkAllObjects();
   
@@ -196,11 +250,27 @@ void KevesGC::execute(const_KevesIterator pc) {
   *gr1_ = tenured_.copy(*gr1_);
   *gr2_ = tenured_.copy(*gr2_);
   *gr3_ = tenured_.copy(*gr3_);
+
+  // more values than VALS_SIZE are kept in a frame, which may be on stack
+  if (*valn_ > KevesVM::VALS_SIZE)
+    *keves_vals_ = tenured_.copy(VariableLengthKev<ArgumentFrameKev>::from(*keves_vals_));
+  else
+    for (int i(0); i < *valn_; ++i) vals_[i] = tenured_.copy(vals_[i]);
   
+  endPhase("copy roots", KevesPerfCounters::GC_COPY_ROOTS, &phase_begin);
   markAndCopy();
+  endPhase("markAndCopy", KevesPerfCounters::GC_MARK_AND_COPY, &phase_begin);
+  if (code_counters_) code_counters_->sweepCodes(this);
   sweep();
+  endPhase("sweep", KevesPerfCounters::GC_SWEEP, &phase_begin);
+
+  if (timeline_) timeline_->addSpan("gc", "gc", gc_begin, phase_begin);
   
-  elapsed_time_ += clock() - start_time;
+  qint64 pause(timer.nsecsElapsed());
+  elapsed_time_ += pause;
+  if (pause_log_) pause_log_->append(pause / 1e9);
+  ++collections_;
+  collecting_ = false;
   longjmp(*jmp_exit_, 0);
 }
 
@@ -255,6 +325,12 @@ KevesValue KevesGC::Tenured::copy(MutableKevesValue value) {
   }
 
   if (!gc_->isInEden(old_address)) return value;
+
+  // a flonum boxed on the stack moves to its immediate form when it fits
+  if (old_address->type() == FlonumKev::TYPE) {
+    KevesValue flonum(FlonumKev::canonicalize(value));
+    if (flonum.isFlonum()) return flonum;
+  }
   
   MutableKev* copy(ft_CopyTo_[old_address->type()](this, old_address));
   old_address->setNewAddress(copy);
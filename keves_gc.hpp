@@ -20,11 +20,17 @@
 #pragma once
 
 #include <setjmp.h>
+#include <QVector>
 #include "keves_iterator.hpp"
 #include "keves_list.hpp"
 #include "keves_value.hpp"
 
 
+class ArgumentFrameKev;
+class KevesAllocProfile;
+class KevesCodeCounters;
+class KevesPerfCounters;
+class KevesTimeline;
 class KevesVM;
 
 
@@ -56,7 +62,42 @@ public:
   void execute(const_KevesIterator);
 
   double getElapsedTime() const {
-    return static_cast<double>(elapsed_time_) / CLOCKS_PER_SEC;
+    return elapsed_time_ / 1e9;
+  }
+
+  // bytes allocated in tenured, including copies by GC
+  size_t allocated_bytes() const {
+    return allocated_bytes_;
+  }
+
+  // bytes copied from eden to tenured by GC
+  size_t promoted_bytes() const {
+    return promoted_bytes_;
+  }
+
+  int collections() const {
+    return collections_;
+  }
+
+  void set_alloc_profile(KevesAllocProfile* alloc_profile) {
+    alloc_profile_ = alloc_profile;
+  }
+
+  void set_code_counters(KevesCodeCounters* code_counters) {
+    code_counters_ = code_counters;
+  }
+
+  void set_timeline(KevesTimeline* timeline) {
+    timeline_ = timeline;
+  }
+
+  void set_perf_counters(KevesPerfCounters* perf_counters) {
+    perf_counters_ = perf_counters;
+  }
+
+  // Append the time of each collection in seconds.
+  void set_pause_log(QVector<double>* pause_log) {
+    pause_log_ = pause_log;
   }
 
   template<class CTOR>
@@ -69,6 +110,10 @@ public:
   
   void markLive(MutableKev*);
 
+  // the address of kev after the collection, or nullptr if it was not
+  // reached, which is valid only between marking and sweeping
+  MutableKev* survivor(MutableKev* kev) const;
+
   const_KevesIterator pc() const {
     return pc_;
   }
@@ -90,6 +135,8 @@ private:
   void pushToTenuredList(KevesBaseNode);
   void pushToMarkedList(MutableKev*);
   void pushToUncheckedList(MutableKev*);
+  void endPhase(const char*, int, double*);
+  void profileAllocation(const MutableKev*, size_t);
   void sweep();
   void unmarkAllObjects();
 
@@ -122,6 +169,7 @@ private:
       decltype(ctor(nullptr)) temp(ctor(ptr));
       temp->markDynamic(); // IMPORTANT !!!
       gc_->pushToMarkedList(temp); // IMPORTANT !!!
+      if (gc_->alloc_profile_) gc_->profileAllocation(temp, size);
       return temp;
     }
 
@@ -157,6 +205,18 @@ private:
   KevesValue* gr1_;
   KevesValue* gr2_;
   KevesValue* gr3_;
-  clock_t elapsed_time_;
+  KevesValue* vals_;
+  int* valn_;
+  ArgumentFrameKev** keves_vals_;
+  qint64 elapsed_time_; // in nanoseconds of wall time
+  size_t allocated_bytes_;
+  size_t promoted_bytes_;
+  int collections_;
+  bool collecting_;
+  KevesAllocProfile* alloc_profile_;
+  KevesCodeCounters* code_counters_;
+  KevesTimeline* timeline_;
+  KevesPerfCounters* perf_counters_;
+  QVector<double>* pause_log_;
   size_t (*ft_size_[0177])(const MutableKev*);
 };
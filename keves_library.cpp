@@ -237,6 +237,7 @@ bool KevesLibrary::writeToFile(KevesCommon* common,
 
   // Write header of library
   QDataStream out(&file);
+  out << KEVC_MAGIC << KEVC_VERSION;
   out << id_ << ver_num_ << indexBinds(object_list) << import_libs.getList();
 
   // write objects
@@ -284,6 +285,15 @@ KevesLibrary* KevesLibrary::readFromFile(const QString& file_name,
   // Read header of library
   QList<KevesImportLibrary> import_libs;
   QDataStream in(&file);
+  quint32 magic(0);
+  quint32 version(0);
+  in >> magic >> version;
+
+  if (magic != KEVC_MAGIC || version != KEVC_VERSION) {
+    errorOfWrongFormat(file_name, magic == KEVC_MAGIC ? version : 0);
+    return nullptr;
+  }
+
   in >> lib->id_ >> lib->ver_num_ >> lib->bind_list_ >> import_libs;
 
   // Get import binds
@@ -303,11 +313,16 @@ KevesLibrary* KevesLibrary::readFromFile(const QString& file_name,
   // Read objects
   uioword value;
 
-  while (!in.atEnd()) {
+  while (!in.atEnd() && in.status() == QDataStream::Ok) {
     in >> value;
     object_list << (*common->ft_readObject(value))(in, common);
   }
 
+  if (in.status() != QDataStream::Ok) {
+    errorOfBrokenFile(file_name);
+    return nullptr;
+  }
+
   common->revertObjects(object_list, import_bind_count);
 
   // Revert export binds
@@ -331,6 +346,21 @@ void KevesLibrary::errorOfMissingLibraryFile(const QString& file_name) {
 }
 
 
+void KevesLibrary::errorOfBrokenFile(const QString& file_name) {
+  std::cerr << "Library: " << qPrintable(file_name) << " is broken!!!\n";
+}
+
+void KevesLibrary::errorOfWrongFormat(const QString& file_name,
+				      quint32 version) {
+  std::cerr << "Library: " << qPrintable(file_name);
+
+  if (version == 0)
+    std::cerr << " is not a kevc file!!!\n";
+  else
+    std::cerr << " has format version " << version
+	      << ", but " << KEVC_VERSION << " is required!!!\n";
+}
+
 void KevesLibrary::errorOfFailedToOpen(const QFile& file) {
   std::cerr << "An error was occurred when reading the file: "
 	    << qPrintable(file.fileName())
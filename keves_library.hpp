@@ -132,6 +132,12 @@ public:
   static QString makeFullName(const QStringList& id,
 			      const QList<ver_num_t>& ver_num);
 
+  // A .kevc file begins with KEVC_MAGIC and KEVC_VERSION. The version is
+  // raised whenever the encoding of objects changes, and files of another
+  // version are rejected; they must be regenerated with kevc_generator.
+  static constexpr quint32 KEVC_MAGIC = 0x4b455643; // "KEVC"
+  static constexpr quint32 KEVC_VERSION = 5; // with APPLY_LAMBDA
+
 private:
   int getImportBinds(KevesCommon* common,
 		     QList<const Kev*>* object_list,
@@ -145,6 +151,8 @@ private:
   void setExportBinds(const QList<const Kev*>& object_list);
 
   static void errorOfFailedToOpen(const QFile& file);
+  static void errorOfBrokenFile(const QString& file_name);
+  static void errorOfWrongFormat(const QString& file_name, quint32 version);
   static void errorOfMissingLibraryFile(const QString& file_name);
   static const char* getErrorMessage(QFile::FileError error_code);
 
@@ -0,0 +1,97 @@
+// keves/keves_log.cpp - leveled logging for Keves
+// Keves will be an R6RS Scheme implementation.
+//
+//  Copyright (C) 2014  Yasuhiro Yamakawa <kawatab@yahoo.co.jp>
+//
+//  This program is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or any
+//  later version.
+//
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+//  License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "keves_log.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <pthread.h>
+#include <unistd.h>
+
+
+namespace {
+  constexpr std::size_t BUFFER_SIZE(4096);
+
+  // written when the thread ends
+  struct LogBuffer {
+    LogBuffer() : data() {
+      data.reserve(BUFFER_SIZE);
+    }
+
+    ~LogBuffer() {
+      write();
+    }
+
+    void write() {
+      const char* ptr(data.data());
+      std::size_t rest(data.size());
+
+      while (rest > 0) {
+	ssize_t written(::write(STDERR_FILENO, ptr, rest));
+	if (written <= 0) break;
+	ptr += written;
+	rest -= written;
+      }
+
+      data.clear();
+    }
+
+    std::string data;
+  };
+
+  thread_local LogBuffer log_buffer;
+
+  const char* const LEVEL_NAMES[] = { "debug", "info", "warning", "error" };
+} // namespace
+
+
+KevesLog::KevesLog(log_level level) : level_(level), stream_() {
+  stream_ << '[' << LEVEL_NAMES[level] << ' '
+	  << std::hex << pthread_self() << std::dec << "] ";
+}
+
+KevesLog::~KevesLog() {
+  stream_ << '\n';
+  std::string line(stream_.str());
+
+  if (log_buffer.data.size() + line.size() > BUFFER_SIZE) log_buffer.write();
+  log_buffer.data += line;
+  if (level_ >= KEVES_LOG_ERROR) log_buffer.write();
+}
+
+void KevesLog::flush() {
+  log_buffer.write();
+}
+
+log_level KevesLog::runtimeLevel() {
+  static const log_level level(readLevel());
+  return level;
+}
+
+log_level KevesLog::readLevel() {
+  const char* env(std::getenv("KEVES_LOG"));
+  if (!env) return KEVES_LOG_INFO;
+  if (std::strcmp(env, "debug") == 0) return KEVES_LOG_DEBUG;
+  if (std::strcmp(env, "info") == 0) return KEVES_LOG_INFO;
+  if (std::strcmp(env, "warning") == 0) return KEVES_LOG_WARNING;
+  if (std::strcmp(env, "error") == 0) return KEVES_LOG_ERROR;
+  if (std::strcmp(env, "none") == 0) return KEVES_LOG_NONE;
+  return KEVES_LOG_INFO;
+}
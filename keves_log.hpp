@@ -0,0 +1,85 @@
+// keves/keves_log.hpp - leveled logging for Keves
+// Keves will be an R6RS Scheme implementation.
+//
+//  Copyright (C) 2014  Yasuhiro Yamakawa <kawatab@yahoo.co.jp>
+//
+//  This program is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or any
+//  later version.
+//
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+//  License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <sstream>
+
+
+/* ----------------------------------------
+ * KEVES_LOG(level) << ... appends a line to a buffer of the current thread,
+ * which is written to stderr at once when it is full, when the thread ends,
+ * when KevesLog::flush() is called, or when the level is KEVES_LOG_ERROR.
+ *
+ * Lines below KEVES_LOG_MIN_LEVEL are removed at compile time. Others are
+ * filtered by the environment variable KEVES_LOG (debug, info, warning,
+ * error or none), whose default is info.
+ * ----------------------------------------
+ */
+
+enum log_level {
+  KEVES_LOG_DEBUG,
+  KEVES_LOG_INFO,
+  KEVES_LOG_WARNING,
+  KEVES_LOG_ERROR,
+  KEVES_LOG_NONE
+};
+
+#ifndef KEVES_LOG_MIN_LEVEL
+#define KEVES_LOG_MIN_LEVEL KEVES_LOG_DEBUG
+#endif
+
+#define KEVES_LOG(level)				\
+  if (!KevesLog::isEnabled(level)) ; else KevesLog(level)
+
+class KevesLog {
+public:
+  KevesLog() = delete;
+  KevesLog(const KevesLog&) = delete;
+  KevesLog(KevesLog&&) = delete;
+  KevesLog& operator=(const KevesLog&) = delete;
+  KevesLog& operator=(KevesLog&&) = delete;
+  ~KevesLog();
+
+  explicit KevesLog(log_level level);
+
+  template<typename T> KevesLog& operator<<(const T& value) {
+    stream_ << value;
+    return *this;
+  }
+
+  // for writers taking std::ostream&; its lines belong to this entry
+  std::ostream& stream() {
+    return stream_;
+  }
+
+  static bool isEnabled(log_level level) {
+    return level >= KEVES_LOG_MIN_LEVEL && level >= runtimeLevel();
+  }
+
+  // write the buffer of the current thread
+  static void flush();
+
+private:
+  static log_level runtimeLevel();
+  static log_level readLevel();
+
+  log_level level_;
+  std::ostringstream stream_;
+};
@@ -0,0 +1,976 @@
+// keves/keves_profile.cpp - profiles of VM for Keves
+// Keves will be an R6RS Scheme implementation.
+//
+//  Copyright (C) 2014  Yasuhiro Yamakawa <kawatab@yahoo.co.jp>
+//
+//  This program is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or any
+//  later version.
+//
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+//  License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "keves_profile.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <QFile>
+#include <QHash>
+#include <QMutexLocker>
+#include <QTextStream>
+#include <QThread>
+#include "keves_common.hpp"
+#include "keves_gc.hpp"
+#include "keves_library.hpp"
+#include "keves_log.hpp"
+#include "kev/code.hpp"
+#include "kev/frame.hpp"
+#include "kev/procedure.hpp"
+
+
+KevesProfile::KevesProfile(const QString& file_name)
+  : counts_(), bigrams_(), last_(END_OF_LIST), file_name_(file_name) {
+}
+
+bool KevesProfile::write(const KevesInstructTable* instruct_table) const {
+  QFile file(file_name_);
+
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Could not write the profile: "
+			       << qPrintable(file_name_);
+    return false;
+  }
+
+  QTextStream out(&file);
+
+  if (file_name_.endsWith(".json"))
+    writeJson(instruct_table, out);
+  else
+    writeCsv(instruct_table, out);
+
+  file.close();
+  return true;
+}
+
+void KevesProfile::writeCsv(const KevesInstructTable* instruct_table,
+			    QTextStream& out) const {
+  out << "kind,first,second,count\n";
+
+  for (int i(0); i < END_OF_LIST; ++i) {
+    KevesInstruct inst(static_cast<keves_instruct>(i));
+
+    if (counts_[i] > 0)
+      out << "count," << instruct_table->getLabel(inst) << ",,"
+	  << counts_[i] << "\n";
+  }
+
+  for (int i(0); i < END_OF_LIST; ++i) {
+    KevesInstruct first(static_cast<keves_instruct>(i));
+
+    for (int j(0); j < END_OF_LIST; ++j) {
+      KevesInstruct second(static_cast<keves_instruct>(j));
+
+      if (bigrams_[i][j] > 0)
+	out << "bigram," << instruct_table->getLabel(first) << ","
+	    << instruct_table->getLabel(second) << ","
+	    << bigrams_[i][j] << "\n";
+    }
+  }
+}
+
+// The labels are names of instructions, which need no escape.
+void KevesProfile::writeJson(const KevesInstructTable* instruct_table,
+			     QTextStream& out) const {
+  const char* separator("\n");
+  out << "{\"counts\": {";
+
+  for (int i(0); i < END_OF_LIST; ++i) {
+    KevesInstruct inst(static_cast<keves_instruct>(i));
+
+    if (counts_[i] > 0) {
+      out << separator << "  \"" << instruct_table->getLabel(inst) << "\": "
+	  << counts_[i];
+      separator = ",\n";
+    }
+  }
+
+  separator = "\n";
+  out << "},\n\"bigrams\": [";
+
+  for (int i(0); i < END_OF_LIST; ++i) {
+    KevesInstruct first(static_cast<keves_instruct>(i));
+
+    for (int j(0); j < END_OF_LIST; ++j) {
+      KevesInstruct second(static_cast<keves_instruct>(j));
+
+      if (bigrams_[i][j] > 0) {
+	out << separator << "  {\"first\": \"" << instruct_table->getLabel(first)
+	    << "\", \"second\": \"" << instruct_table->getLabel(second)
+	    << "\", \"count\": " << bigrams_[i][j] << "}";
+	separator = ",\n";
+      }
+    }
+  }
+
+  out << "]}\n";
+}
+
+KevesCodeCounters::KevesCodeCounters(const QString& file_name)
+  : counters_(), file_name_(file_name) {
+}
+
+KevesCodeCounters::Counter* KevesCodeCounters::enter(const CodeKev* code) {
+  const KevesValue* end(&*code->begin() + code->size());
+  auto iter(counters_.find(end));
+
+  if (iter == counters_.end())
+    iter = counters_.insert(end, Counter{code, 0, 0});
+
+  return &iter.value();
+}
+
+KevesCodeCounters::Counter* KevesCodeCounters::find(const_KevesIterator pc) {
+  auto iter(counters_.upperBound(&*pc));
+
+  if (iter == counters_.end() || pc < iter.value().code->begin())
+    return nullptr;
+
+  return &iter.value();
+}
+
+void KevesCodeCounters::sweepCodes(KevesGC* gc) {
+  QMap<const KevesValue*, Counter> survivors;
+
+  for (auto counter : counters_) {
+    const MutableKev* kev(gc->survivor(const_cast<CodeKev*>(counter.code)));
+    if (!kev) continue;
+
+    counter.code = static_cast<const CodeKev*>(kev);
+    survivors.insert(&*counter.code->begin() + counter.code->size(), counter);
+  }
+
+  counters_ = survivors;
+}
+
+KevesSampler::KevesSampler(const QString& file_name, int hz)
+  : samples_(new Sample[MAX_SAMPLES]), count_(0), dropped_(0), pending_(0),
+    hz_(hz), timer_(), running_(false), file_name_(file_name) {
+}
+
+KevesSampler::~KevesSampler() {
+  stop();
+  delete[] samples_;
+}
+
+bool KevesSampler::start() {
+  stop();
+
+  struct sigaction action;
+  action.sa_sigaction = &handleSignal;
+  action.sa_flags = SA_RESTART | SA_SIGINFO;
+  sigemptyset(&action.sa_mask);
+
+  if (sigaction(SIGPROF, &action, nullptr) != 0) return false;
+
+  // a timer of the CPU time of this thread, which signals only it and
+  // passes this sampler to the handler
+  struct sigevent event;
+  std::memset(&event, 0, sizeof(event));
+  event.sigev_notify = SIGEV_THREAD_ID;
+  event.sigev_signo = SIGPROF;
+  event.sigev_value.sival_ptr = this;
+  event._sigev_un._tid = static_cast<pid_t>(syscall(SYS_gettid));
+
+  if (timer_create(CLOCK_THREAD_CPUTIME_ID, &event, &timer_) != 0)
+    return false;
+
+  struct itimerspec spec;
+  spec.it_interval.tv_sec = 0;
+  spec.it_interval.tv_nsec = 1000000000L / hz_;
+  spec.it_value = spec.it_interval;
+
+  if (timer_settime(timer_, 0, &spec, nullptr) != 0) {
+    timer_delete(timer_);
+    return false;
+  }
+
+  running_ = true;
+  return true;
+}
+
+void KevesSampler::stop() {
+  if (!running_) return;
+
+  timer_delete(timer_);
+  running_ = false;
+  pending_ = 0;
+}
+
+// Only the flag of the sampler passed by the timer is set here, which is
+// async-signal-safe.
+void KevesSampler::handleSignal(int, siginfo_t* info, void*) {
+  static_cast<KevesSampler*>(info->si_value.sival_ptr)->pending_ = 1;
+}
+
+void KevesSampler::record(const_KevesIterator pc,
+			  const StackFrameKev* registers) {
+  pending_ = 0;
+  Sample* sample(nextSample());
+  if (!sample) return;
+
+  const StackFrameKev* frame(registers->fp());
+  int depth(0);
+
+  // the bottom frame holds the return point to the top level
+  while (frame && frame != registers && depth < MAX_DEPTH) {
+    sample->pcs[depth++] = frame->pc();
+    if (StackFrameKev::isBottom(frame)) break;
+    frame = frame->fp();
+  }
+
+  sample->pc = pc;
+  sample->depth = depth;
+  sample->in_gc = false;
+}
+
+void KevesSampler::recordGC() {
+  pending_ = 0;
+  Sample* sample(nextSample());
+  if (!sample) return;
+
+  sample->pc = const_KevesIterator();
+  sample->depth = 0;
+  sample->in_gc = true;
+}
+
+KevesSampler::Sample* KevesSampler::nextSample() {
+  if (count_ >= MAX_SAMPLES) {
+    ++dropped_;
+    return nullptr;
+  }
+
+  return samples_ + count_++;
+}
+
+QHash<const CodeKev*, QString> nameCodesByBinds(KevesCommon* common) {
+  QHash<const CodeKev*, QString> names;
+
+  for (auto library : common->libraries()) {
+    for (auto bind : *library->getBindList()) {
+      KevesValue value(KevesValue::fromUioword<Kev>(bind.second));
+
+      if (value.is<LambdaKev>()) {
+	const LambdaKev* lambda(value);
+	names.insert(lambda->code(), bind.first);
+      }
+    }
+  }
+
+  return names;
+}
+
+namespace {
+  QString nameOfAddress(const char* prefix, const void* ptr) {
+    return QString("%1@%2").arg(prefix)
+      .arg(reinterpret_cast<quintptr>(ptr), 0, 16);
+  }
+
+  // The names of codes are resolved once for a report, and each pc is
+  // looked up by the end of the code holding it, as KevesCodeCounters does.
+  class CodeNames {
+  public:
+    explicit CodeNames(KevesCommon* common) : codes_() {
+      QHash<const CodeKev*, QString> names(nameCodesByBinds(common));
+
+      for (auto iter(names.begin()); iter != names.end(); ++iter) {
+	const CodeKev* code(iter.key());
+	codes_.insert(&*code->begin() + code->size(),
+		      qMakePair(code, iter.value()));
+      }
+    }
+
+    // the name of the code which holds pc
+    QString nameOfCode(const_KevesIterator pc) const {
+      auto iter(find(pc));
+      return iter != codes_.end() ?
+	iter.value().second : nameOfAddress("pc", &*pc);
+    }
+
+    // the name of the code which holds pc, with the offset of pc in it
+    QString nameOfInstruct(const_KevesIterator pc) const {
+      auto iter(find(pc));
+
+      if (iter == codes_.end()) return nameOfAddress("pc", &*pc);
+
+      return QString("%1+%2").arg(iter.value().second)
+	.arg(pc - iter.value().first->begin());
+    }
+
+  private:
+    typedef QMap<const KevesValue*, QPair<const CodeKev*, QString> > Map;
+
+    Map::const_iterator find(const_KevesIterator pc) const {
+      auto iter(codes_.upperBound(&*pc));
+
+      if (iter != codes_.end() && pc < iter.value().first->begin())
+	return codes_.end();
+
+      return iter;
+    }
+
+    Map codes_;
+  };
+}
+
+bool KevesCodeCounters::write(KevesCommon* common) const {
+  if (file_name_.isEmpty()) return true;
+
+  QFile file(file_name_);
+
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Could not write the code counters: "
+			       << qPrintable(file_name_);
+    return false;
+  }
+
+  QVector<Counter> counters;
+  for (auto counter : counters_) counters.append(counter);
+
+  std::sort(counters.begin(), counters.end(),
+	    [](const Counter& lhs, const Counter& rhs) {
+	      return lhs.entries > rhs.entries;
+	    });
+
+  QHash<const CodeKev*, QString> names(nameCodesByBinds(common));
+  QTextStream out(&file);
+  out << "name,size,entries,back_edges\n";
+
+  for (auto counter : counters)
+    out << names.value(counter.code, nameOfAddress("code", counter.code))
+	<< "," << counter.code->size() << "," << counter.entries
+	<< "," << counter.back_edges << "\n";
+
+  file.close();
+  return true;
+}
+
+bool KevesSampler::write(KevesCommon* common) const {
+  CodeNames names(common);
+  QHash<QString, int> stacks;
+
+  for (int i(0); i < count_; ++i) {
+    const Sample& sample(samples_[i]);
+    QString stack;
+
+    for (int j(sample.depth - 1); j >= 0; --j)
+      stack.append(names.nameOfCode(sample.pcs[j])).append(';');
+
+    if (sample.in_gc)
+      stack.append("gc");
+    // no instruction has been dispatched yet
+    else if (sample.pc == const_KevesIterator())
+      stack.append("toplevel");
+    else
+      stack.append(names.nameOfInstruct(sample.pc));
+
+    ++stacks[stack];
+  }
+
+  QFile file(file_name_);
+
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Could not write the samples: "
+			       << qPrintable(file_name_);
+    return false;
+  }
+
+  QTextStream out(&file);
+
+  for (auto iter(stacks.begin()); iter != stacks.end(); ++iter)
+    out << iter.key() << " " << iter.value() << "\n";
+
+  if (dropped_ > 0)
+    KEVES_LOG(KEVES_LOG_WARNING) << "KevesSampler: dropped " << dropped_
+				 << " samples";
+
+  file.close();
+  return true;
+}
+
+KevesCallProfile::KevesCallProfile(const QString& file_name)
+  : timer_(), records_(), index_(), calls_(), file_name_(file_name) {
+  timer_.start();
+}
+
+void KevesCallProfile::enter(KevesValue who, const CodeKev* code,
+			     const StackFrameKev* frame) {
+  quintptr key(code ? reinterpret_cast<quintptr>(code) : who.toUIntPtr());
+  auto iter(index_.find(key));
+  int idx;
+
+  if (iter == index_.end()) {
+    idx = records_.size();
+    records_.append(Record{who, code, 0, 0, 0, 0});
+    index_.insert(key, idx);
+  } else {
+    idx = iter.value();
+  }
+
+  Record& record(records_[idx]);
+  ++record.calls;
+  ++record.active;
+  calls_.append(Call{frame, -1, idx, timer_.nsecsElapsed(), 0});
+}
+
+void KevesCallProfile::leave(const StackFrameKev* frame) {
+  int i(calls_.size());
+
+  while (i > 0 && calls_[i - 1].frame != frame) --i;
+
+  if (i == 0) return; // the frame was not made for a call
+
+  // calls in tail position share the frame of their caller
+  while (i > 0 && calls_[i - 1].frame == frame) --i;
+
+  // calls above it were left by an escape
+  qint64 now(timer_.nsecsElapsed());
+
+  while (calls_.size() > i) popCall(now);
+}
+
+void KevesCallProfile::leaveAll() {
+  qint64 now(timer_.nsecsElapsed());
+
+  while (!calls_.isEmpty()) popCall(now);
+}
+
+void KevesCallProfile::popCall(qint64 now) {
+  Call call(calls_.takeLast());
+  qint64 time(now - call.start);
+  Record& record(records_[call.record]);
+  record.exclusive += time - call.children;
+
+  // recursive calls are counted in the outermost one
+  if (--record.active == 0) record.inclusive += time;
+
+  if (!calls_.isEmpty()) calls_.last().children += time;
+}
+
+namespace {
+  int depthOfFrames(const StackFrameKev* registers,
+		    QHash<const StackFrameKev*, int>* depths,
+		    QVector<const StackFrameKev*>* frames) {
+    const StackFrameKev* frame(registers->fp());
+    int depth(0);
+
+    while (frame && frame != registers) {
+      if (depths) depths->insert(frame, depth);
+      if (frames) frames->append(frame);
+      ++depth;
+      if (StackFrameKev::isBottom(frame)) break;
+      frame = frame->fp();
+    }
+
+    return depth;
+  }
+}
+
+void KevesCallProfile::saveFrames(const StackFrameKev* registers) {
+  QHash<const StackFrameKev*, int> depths;
+  depthOfFrames(registers, &depths, nullptr);
+
+  for (auto& call : calls_) call.depth = depths.value(call.frame, -1);
+}
+
+void KevesCallProfile::restoreFrames(const StackFrameKev* registers) {
+  QVector<const StackFrameKev*> frames;
+  depthOfFrames(registers, nullptr, &frames);
+
+  for (auto& call : calls_) {
+    if (call.depth >= 0) call.frame = frames.value(call.depth, nullptr);
+    call.depth = -1;
+  }
+}
+
+QVector<KevesCallProfile::Record> KevesCallProfile::records() const {
+  QVector<Record> records(records_);
+
+  std::sort(records.begin(), records.end(),
+	    [](const Record& lhs, const Record& rhs) {
+	      return lhs.exclusive > rhs.exclusive;
+	    });
+
+  return records;
+}
+
+QString KevesCallProfile::nameOf(KevesCommon* common,
+				 const QHash<const CodeKev*, QString>& names,
+				 const Record& record) {
+  if (!record.code) return common->toString(record.who);
+
+  return names.value(record.code, nameOfAddress("code", record.code));
+}
+
+bool KevesCallProfile::write(KevesCommon* common) const {
+  QFile file(file_name_);
+
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Could not write the call profile: "
+			       << qPrintable(file_name_);
+    return false;
+  }
+
+  QHash<const CodeKev*, QString> names(nameCodesByBinds(common));
+  QTextStream out(&file);
+  out << "name,calls,inclusive_ns,exclusive_ns\n";
+
+  for (auto record : records())
+    out << nameOf(common, names, record) << "," << record.calls << ","
+	<< record.inclusive << "," << record.exclusive << "\n";
+
+  file.close();
+  return true;
+}
+
+
+KevesAllocProfile::KevesAllocProfile(const QString& file_name,
+				     const KevesValue* const volatile* running_pc)
+  : totals_(), sites_(), bytes_to_sample_(0),
+    running_pc_(running_pc), file_name_(file_name) {
+}
+
+void KevesAllocProfile::sample(kev_type type) {
+  Total& total(sites_[Site{*running_pc_, type & 077}]);
+  ++total.count;
+  total.bytes += bytes_to_sample_;
+  bytes_to_sample_ = 0;
+}
+
+namespace {
+  const char* nameOfType(int type) {
+    switch (type) {
+    case CODE: return "code";
+    case BIGNUM: return "bignum";
+    case RATIONAL_NUM: return "rational";
+    case FLONUM: return "flonum";
+    case EXCT_CPLX_NUM: return "exact-complex";
+    case INEX_CPLX_NUM: return "inexact-complex";
+    case STRING_CORE: return "string-core";
+    case STRING: return "string";
+    case SYMBOL: return "symbol";
+    case VECTOR: return "vector";
+    case WIND: return "wind";
+    case REFERENCE: return "reference";
+    case RECORD: return "record";
+    case CONDITION_SMP: case CONDITION_CMP: case CONDITION_AST:
+      return "condition";
+    case LAMBDA: return "lambda";
+    case ESCAPE: return "escape";
+    case CONTINUATION: return "continuation";
+    case ARG_FRAME: return "argument-frame";
+    case LOCAL_FRAME: return "local-frame";
+    case PAIR: return "pair";
+    case ENVIRONMENT: return "environment";
+    case STACK_FRAME: case STACK_FRAME_B: case STACK_FRAME_D: case STACK_FRAME_E:
+      return "stack-frame";
+    default: return "other";
+    }
+  }
+}
+
+bool KevesAllocProfile::write(KevesCommon* common) const {
+  QFile file(file_name_);
+
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Could not write the allocation profile: "
+			       << qPrintable(file_name_);
+    return false;
+  }
+
+  QTextStream out(&file);
+  QList<QPair<Site, Total> > sites;
+  quint64 sampled_bytes(0);
+
+  for (auto iter(sites_.begin()); iter != sites_.end(); ++iter) {
+    sites.append(qMakePair(iter.key(), iter.value()));
+    sampled_bytes += iter.value().bytes;
+  }
+
+  std::sort(sites.begin(), sites.end(),
+	    [](const QPair<Site, Total>& lhs, const QPair<Site, Total>& rhs) {
+	      return lhs.second.bytes > rhs.second.bytes;
+	    });
+
+  CodeNames names(common);
+  out << "top sites of objects made in tenured by sampled bytes, "
+      << "one sample in every " << SAMPLE_BYTES << " bytes\n";
+
+  for (int i(0); i < sites.size() && i < TOP_N; ++i) {
+    const Site& site(sites.at(i).first);
+    const Total& total(sites.at(i).second);
+    QString name(site.pc ?
+		 names.nameOfInstruct(const_KevesIterator(site.pc)) :
+		 QString("toplevel"));
+
+    out << qSetFieldWidth(12) << total.bytes << qSetFieldWidth(0)
+	<< QString(" %1% ").arg(100.0 * total.bytes / sampled_bytes, 5, 'f', 1)
+	<< nameOfType(site.type) << " at " << name << "\n";
+  }
+
+  out << "\ntotals by type\n";
+
+  for (int promoted(0); promoted < 2; ++promoted) {
+    for (int type(0); type < 0100; ++type) {
+      const Total& total(totals_[promoted][type]);
+
+      if (total.count > 0)
+	out << qSetFieldWidth(12) << total.bytes << qSetFieldWidth(0)
+	    << " bytes in " << total.count << " "
+	    << (promoted ? "promoted " : "made ")
+	    << nameOfType(type) << "\n";
+    }
+  }
+
+  file.close();
+  return true;
+}
+
+KevesPerfCounters::KevesPerfCounters()
+  : fds_(), slots_(), leader_(-1), totals_(), last_() {
+  std::fill_n(fds_, NUM_COUNTERS, -1);
+  std::fill_n(slots_, NUM_COUNTERS, -1);
+}
+
+KevesPerfCounters::~KevesPerfCounters() {
+  closeAll();
+}
+
+void KevesPerfCounters::closeAll() {
+  for (int i(0); i < NUM_COUNTERS; ++i) {
+    if (fds_[i] >= 0) close(fds_[i]);
+    fds_[i] = -1;
+    slots_[i] = -1;
+  }
+
+  leader_ = -1;
+}
+
+bool KevesPerfCounters::open() {
+  static const struct {
+    quint32 type;
+    quint64 config;
+  } events[NUM_COUNTERS] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+      | PERF_COUNT_HW_CACHE_OP_READ << 8
+      | PERF_COUNT_HW_CACHE_RESULT_MISS << 16 },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES }
+  };
+
+  closeAll();
+  int num_slots(0);
+
+  for (int i(0); i < NUM_COUNTERS; ++i) {
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = events[i].type;
+    attr.config = events[i].config;
+    attr.read_format = PERF_FORMAT_GROUP
+      | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // the calling thread on any CPU, and the first opened leads the group
+    int group_fd(leader_ >= 0 ? fds_[leader_] : -1);
+    fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1,
+				       group_fd, 0));
+    if (fds_[i] < 0) continue;
+
+    if (leader_ < 0) leader_ = i;
+    slots_[i] = num_slots++;
+  }
+
+  if (leader_ < 0)
+    KEVES_LOG(KEVES_LOG_WARNING)
+      << "KevesPerfCounters: perf_event_open is not available";
+
+  return leader_ >= 0;
+}
+
+void KevesPerfCounters::read(Values* values) const {
+  // nr, time_enabled, time_running and the values in the group
+  quint64 data[3 + NUM_COUNTERS] = {};
+
+  if (leader_ >= 0) {
+    ssize_t size(::read(fds_[leader_], data, sizeof(data)));
+    if (size < static_cast<ssize_t>(3 * sizeof(quint64))) data[2] = 0;
+  }
+
+  quint64 enabled(data[1]);
+  quint64 running(data[2]);
+
+  for (int i(0); i < NUM_COUNTERS; ++i) {
+    quint64 count(0);
+
+    if (slots_[i] >= 0 && running > 0) {
+      count = data[3 + slots_[i]];
+      if (running < enabled)
+	count = static_cast<quint64>(static_cast<double>(count)
+				     * enabled / running);
+    }
+
+    values->counts[i] = count;
+  }
+}
+
+void KevesPerfCounters::add(phase p, const Values& begin, const Values& end) {
+  for (int i(0); i < NUM_COUNTERS; ++i)
+    totals_[p].counts[i] += end.counts[i] - begin.counts[i];
+}
+
+void KevesPerfCounters::endPhase(phase p) {
+  Values now;
+  read(&now);
+  add(p, last_, now);
+  last_ = now;
+}
+
+void KevesPerfCounters::report(std::ostream& out) const {
+  static const char* const phases[NUM_PHASES] = {
+    "execute", "gc copy roots", "gc markAndCopy", "gc sweep"
+  };
+
+  static const char* const counters[NUM_COUNTERS] = {
+    "instructions", "cycles", "branch misses", "L1D misses", "LLC misses"
+  };
+
+  for (int p(0); p < NUM_PHASES; ++p) {
+    out << phases[p] << ":";
+
+    for (int i(0); i < NUM_COUNTERS; ++i) {
+      if (fds_[i] >= 0)
+	out << " " << counters[i] << " " << totals_[p].counts[i] << ",";
+    }
+
+    out << "\n";
+  }
+}
+
+KevesTimeline::KevesTimeline(const QString& file_name)
+  : timer_(), mutex_(), spans_(), file_name_(file_name) {
+  timer_.start();
+}
+
+void KevesTimeline::addSpan(const QString& name, const char* category,
+			    double begin, double end) {
+  quintptr tid(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+  QMutexLocker locker(&mutex_);
+  spans_.append(Span{name, category, tid, begin, end - begin});
+}
+
+bool KevesTimeline::write() const {
+  QFile file(file_name_);
+
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+    KEVES_LOG(KEVES_LOG_ERROR) << "Could not write the timeline: "
+			       << qPrintable(file_name_);
+    return false;
+  }
+
+  QMutexLocker locker(&mutex_);
+  QTextStream out(&file);
+  out << "{\"traceEvents\":[\n";
+
+  for (int i(0); i < spans_.size(); ++i) {
+    const Span& span(spans_.at(i));
+    QString name(span.name);
+    name.replace('\\', "\\\\").replace('"', "\\\"");
+
+    out << (i > 0 ? ",\n" : "")
+	<< "{\"name\":\"" << name << "\",\"cat\":\"" << span.category
+	<< "\",\"ph\":\"X\",\"ts\":" << QString::number(span.begin, 'f', 3)
+	<< ",\"dur\":" << QString::number(span.duration, 'f', 3)
+	<< ",\"pid\":1,\"tid\":" << span.tid << "}";
+  }
+
+  out << "\n]}\n";
+  file.close();
+  return true;
+}
+
+KevesVMTimeline::KevesVMTimeline(KevesTimeline* timeline, KevesCommon* common)
+  : timeline_(timeline), common_(common), top_level_(nullptr), names_(),
+    spans_() {
+}
+
+void KevesVMTimeline::call(KevesValue proc, const_KevesIterator return_pc) {
+  if (!top_level_ || return_pc < top_level_->begin()
+      || !(return_pc < top_level_->end()))
+    return;
+
+  // a call in tail position continues the span
+  if (!spans_.isEmpty() && spans_.last().return_pc == return_pc) return;
+
+  if (names_.isEmpty()) names_ = nameCodesByBinds(common_);
+
+  if (proc.is<LambdaKev>()) {
+    const LambdaKev* lambda(proc);
+    return begin(names_.value(lambda->code(), nameOfAddress("code", lambda->code())),
+		 return_pc);
+  }
+
+  if (proc.is<CPSKev>()) {
+    const CPSKev* cps(proc);
+    return begin(common_->toString(cps->who()), return_pc);
+  }
+
+  return begin("procedure", return_pc);
+}
+
+void KevesVMTimeline::begin(const QString& name, const_KevesIterator return_pc) {
+  spans_.append(OpenSpan{name, return_pc, now()});
+}
+
+void KevesVMTimeline::endSpan() {
+  OpenSpan span(spans_.takeLast());
+  addSpan(span.name, "vm", span.begin);
+}
+
+#ifdef KEVES_TRACE
+
+std::atomic<KevesTrace*> KevesTrace::traces_[MAX_TRACES];
+
+KevesTrace::KevesTrace(const KevesInstructTable* instruct_table)
+  : entries_(), index_(0), allocated_bytes_at_gc_(0),
+    instruct_table_(instruct_table) {
+  for (auto& trace : traces_) {
+    KevesTrace* empty(nullptr);
+    if (trace.compare_exchange_strong(empty, this)) return;
+  }
+
+  KEVES_LOG(KEVES_LOG_WARNING)
+    << "KevesTrace: too many traces to dump on a signal";
+}
+
+KevesTrace::~KevesTrace() {
+  for (auto& trace : traces_) {
+    KevesTrace* self(this);
+    if (trace.compare_exchange_strong(self, nullptr)) return;
+  }
+}
+
+namespace {
+  // a line buffer which can be used in a signal handler
+  class TraceLine {
+  public:
+    TraceLine() : size_(0) {}
+
+    TraceLine& operator<<(const char* str) {
+      while (*str && size_ < SIZE) buffer_[size_++] = *str++;
+      return *this;
+    }
+
+    TraceLine& hex(quintptr value) {
+      char digits[2 * sizeof(quintptr)];
+      int n(0);
+
+      do {
+	digits[n++] = "0123456789abcdef"[value & 0xf];
+	value >>= 4;
+      } while (value > 0);
+
+      *this << "0x";
+      while (n > 0 && size_ < SIZE) buffer_[size_++] = digits[--n];
+      return *this;
+    }
+
+    void write(int fd) {
+      *this << "\n";
+      ssize_t result(::write(fd, buffer_, size_));
+      Q_UNUSED(result);
+      size_ = 0;
+    }
+
+  private:
+    static constexpr int SIZE = 128;
+    char buffer_[SIZE];
+    int size_;
+  };
+}
+
+void KevesTrace::dump(int fd) const {
+  quint64 end(index_.load(std::memory_order_acquire));
+  quint64 begin(end > SIZE ? end - SIZE : 0);
+  TraceLine line;
+  line << "trace of ";
+  line.hex(reinterpret_cast<quintptr>(this)).write(fd);
+
+  for (quint64 i(begin); i < end; ++i) {
+    const Entry& entry(entries_[i & (SIZE - 1)]);
+
+    switch (entry.kind) {
+    case INSTRUCT:
+      line << "  ";
+      line.hex(reinterpret_cast<quintptr>(entry.pc)) << " ";
+      line << instruct_table_->getLabel(KevesInstruct(static_cast<keves_instruct>(entry.data)));
+      line << " acc:";
+      line.hex(entry.value);
+      break;
+
+    case CALL:
+      line << "  ";
+      line.hex(reinterpret_cast<quintptr>(entry.pc)) << " call ";
+      line.hex(entry.value) << " type:";
+      line.hex(entry.data);
+      break;
+
+    case GC_START:
+      line << "  ";
+      line.hex(reinterpret_cast<quintptr>(entry.pc)) << " gc start, allocated:";
+      line.hex(entry.value);
+      break;
+
+    default: // GC_END
+      line << "  gc end, promoted:";
+      line.hex(entry.value);
+      break;
+    }
+
+    line.write(fd);
+  }
+}
+
+void KevesTrace::dumpAll(int fd) {
+  for (auto& trace : traces_) {
+    KevesTrace* temp(trace.load());
+    if (temp) temp->dump(fd);
+  }
+}
+
+bool KevesTrace::installSignalHandler(int signum) {
+  struct sigaction action;
+  action.sa_handler = &handleSignal;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  return sigaction(signum, &action, nullptr) == 0;
+}
+
+void KevesTrace::handleSignal(int) {
+  dumpAll(STDERR_FILENO);
+}
+
+#endif // KEVES_TRACE
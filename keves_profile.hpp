@@ -0,0 +1,521 @@
+// keves/keves_profile.hpp - profiles of VM for Keves
+// Keves will be an R6RS Scheme implementation.
+//
+//  Copyright (C) 2014  Yasuhiro Yamakawa <kawatab@yahoo.co.jp>
+//
+//  This program is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or any
+//  later version.
+//
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+//  License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <atomic>
+#include <csignal>
+#include <ctime>
+#include <ostream>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMap>
+#include <QMutex>
+#include <QString>
+#include <QTextStream>
+#include <QVector>
+#include "keves_iterator.hpp"
+#include "keves_value.hpp"
+#include "value/instruct.hpp"
+
+
+class CodeKev;
+class KevesCommon;
+class KevesGC;
+class StackFrameKev;
+
+
+// names of lambda codes by the export binds of loaded libraries
+QHash<const CodeKev*, QString> nameCodesByBinds(KevesCommon* common);
+
+class KevesProfile {
+public:
+  KevesProfile() = delete;
+  KevesProfile(const KevesProfile&) = delete;
+  KevesProfile(KevesProfile&&) = delete;
+  KevesProfile& operator=(const KevesProfile&) = delete;
+  KevesProfile& operator=(KevesProfile&&) = delete;
+  ~KevesProfile() = default;
+
+  explicit KevesProfile(const QString& file_name);
+
+  void countInstruct(keves_instruct inst) {
+    ++counts_[inst];
+    ++bigrams_[last_][inst];
+    last_ = inst;
+  }
+
+  // write counts of instructions and pairs of them, as JSON if the file
+  // name ends with .json, otherwise as CSV
+  bool write(const KevesInstructTable* instruct_table) const;
+
+private:
+  void writeCsv(const KevesInstructTable* instruct_table,
+		QTextStream& out) const;
+  void writeJson(const KevesInstructTable* instruct_table,
+		 QTextStream& out) const;
+
+  quint64 counts_[END_OF_LIST];
+  quint64 bigrams_[END_OF_LIST + 1][END_OF_LIST]; // END_OF_LIST as the first
+  int last_;
+  QString file_name_;
+};
+
+// Counters of entries and back edges of code for tiered execution. Each VM
+// has its own counters, so shared code is never written by two threads.
+// Counted code is kept alive by GC, so its address is not reused.
+class KevesCodeCounters {
+public:
+  struct Counter {
+    const CodeKev* code;
+    quint32 entries;
+    quint32 back_edges;
+  };
+
+  KevesCodeCounters() = delete;
+  KevesCodeCounters(const KevesCodeCounters&) = delete;
+  KevesCodeCounters(KevesCodeCounters&&) = delete;
+  KevesCodeCounters& operator=(const KevesCodeCounters&) = delete;
+  KevesCodeCounters& operator=(KevesCodeCounters&&) = delete;
+  ~KevesCodeCounters() = default;
+
+  // The counters are written to the file at the end, unless it is empty.
+  explicit KevesCodeCounters(const QString& file_name);
+
+  // the counter of the code, which is added at its first entry
+  Counter* enter(const CodeKev* code);
+
+  // the counter of the code holding pc, or nullptr if it was not entered
+  Counter* find(const_KevesIterator pc);
+
+  // The counters hold their codes weakly. It is called by the GC after
+  // marking: the counter of a code which was not reached is dropped, and
+  // the others follow their codes if they were moved.
+  void sweepCodes(KevesGC* gc);
+
+  // write all the counters as CSV, sorted by entries
+  bool write(KevesCommon* common) const;
+
+private:
+  QMap<const KevesValue*, Counter> counters_; // by the end of the code
+  QString file_name_;
+};
+
+class KevesSampler {
+public:
+  static constexpr int MAX_DEPTH = 16;
+  static constexpr int MAX_SAMPLES = 32768;
+
+  KevesSampler() = delete;
+  KevesSampler(const KevesSampler&) = delete;
+  KevesSampler(KevesSampler&&) = delete;
+  KevesSampler& operator=(const KevesSampler&) = delete;
+  KevesSampler& operator=(KevesSampler&&) = delete;
+  ~KevesSampler();
+
+  KevesSampler(const QString& file_name, int hz);
+
+  // SIGPROF is raised to the calling thread every 1/hz second of its own
+  // CPU time, so it must be called on the thread of the VM.
+  bool start();
+  void stop();
+
+  // The handler of SIGPROF only requests a sample, which the VM takes at
+  // its next safe point, between instructions where the frames are
+  // complete, or after GC.
+  bool pending() const {
+    return pending_;
+  }
+
+  // pc is of the instruction the VM was running when it was requested
+  void record(const_KevesIterator pc, const StackFrameKev* registers);
+  void recordGC();
+
+  // write the samples as folded stacks for flame graphs, of which the
+  // leaf is the running code with the offset of pc in it
+  bool write(KevesCommon* common) const;
+
+private:
+  struct Sample {
+    const_KevesIterator pc; // of the running instruction
+    int depth;
+    bool in_gc;
+    const_KevesIterator pcs[MAX_DEPTH]; // return points, innermost first
+  };
+
+  static void handleSignal(int, siginfo_t* info, void*);
+  Sample* nextSample();
+
+  Sample* samples_;
+  int count_;
+  int dropped_;
+  volatile sig_atomic_t pending_;
+  int hz_;
+  timer_t timer_;
+  bool running_;
+  QString file_name_;
+};
+
+class KevesCallProfile {
+public:
+  // times are in nanoseconds, and inclusive ones of recursive calls are
+  // counted only in the outermost call
+  struct Record {
+    KevesValue who; // for CPS procedures
+    const CodeKev* code; // for lambdas
+    quint64 calls;
+    qint64 inclusive;
+    qint64 exclusive;
+    int active;
+  };
+
+  KevesCallProfile() = delete;
+  KevesCallProfile(const KevesCallProfile&) = delete;
+  KevesCallProfile(KevesCallProfile&&) = delete;
+  KevesCallProfile& operator=(const KevesCallProfile&) = delete;
+  KevesCallProfile& operator=(KevesCallProfile&&) = delete;
+  ~KevesCallProfile() = default;
+
+  explicit KevesCallProfile(const QString& file_name);
+
+  // A call is left when the frame which was current at the call is
+  // unwound, together with the calls in tail position from it.
+  void enter(KevesValue who, const CodeKev* code, const StackFrameKev* frame);
+  void leave(const StackFrameKev* frame);
+  void leaveAll();
+
+  // Frames are moved by GC, so calls keep the depth of their frames
+  // through it.
+  void saveFrames(const StackFrameKev* registers);
+  void restoreFrames(const StackFrameKev* registers);
+
+  // records sorted by the exclusive time
+  QVector<Record> records() const;
+
+  static QString nameOf(KevesCommon* common,
+			const QHash<const CodeKev*, QString>& names,
+			const Record& record);
+
+  // write the records as CSV
+  bool write(KevesCommon* common) const;
+
+private:
+  struct Call {
+    const StackFrameKev* frame;
+    int depth;
+    int record;
+    qint64 start;
+    qint64 children;
+  };
+
+  void popCall(qint64 now);
+
+  QElapsedTimer timer_;
+  QVector<Record> records_;
+  QHash<quintptr, int> index_;
+  QVector<Call> calls_;
+  QString file_name_;
+};
+
+class KevesAllocProfile {
+public:
+  static constexpr size_t SAMPLE_BYTES = 4096;
+  static constexpr int TOP_N = 40;
+
+  KevesAllocProfile() = delete;
+  KevesAllocProfile(const KevesAllocProfile&) = delete;
+  KevesAllocProfile(KevesAllocProfile&&) = delete;
+  KevesAllocProfile& operator=(const KevesAllocProfile&) = delete;
+  KevesAllocProfile& operator=(KevesAllocProfile&&) = delete;
+  ~KevesAllocProfile() = default;
+
+  // running_pc points to the pc of the instruction which the VM is
+  // running, which the VM keeps while the profile is on
+  KevesAllocProfile(const QString& file_name,
+		    const KevesValue* const volatile* running_pc);
+
+  // Totals by type are exact. Promotions have no site, since GC copies
+  // objects made anywhere, so an allocation in every SAMPLE_BYTES made
+  // directly in tenured is taken to find its site.
+  void allocate(kev_type type, size_t size, bool promoted) {
+    Total& total(totals_[promoted][type & 077]);
+    ++total.count;
+    total.bytes += size;
+
+    if (promoted) return;
+
+    bytes_to_sample_ += size;
+    if (bytes_to_sample_ >= SAMPLE_BYTES) sample(type);
+  }
+
+  // write the top sites and totals by type
+  bool write(KevesCommon* common) const;
+
+private:
+  struct Total {
+    quint64 count;
+    quint64 bytes;
+  };
+
+  struct Site {
+    const KevesValue* pc; // of the instruction, or nullptr
+    int type;
+
+    bool operator==(const Site& other) const {
+      return pc == other.pc && type == other.type;
+    }
+
+    friend uint qHash(const Site& site) {
+      return ::qHash(reinterpret_cast<quintptr>(site.pc)) ^ ::qHash(site.type);
+    }
+  };
+
+  void sample(kev_type type);
+
+  Total totals_[2][0100];
+  QHash<Site, Total> sites_;
+  size_t bytes_to_sample_;
+  const KevesValue* const volatile* running_pc_;
+  QString file_name_;
+};
+
+// hardware counters of the calling thread by perf_event_open
+class KevesPerfCounters {
+public:
+  enum counter {
+    INSTRUCTIONS, CYCLES, BRANCH_MISSES, L1D_MISSES, LLC_MISSES,
+    NUM_COUNTERS
+  };
+
+  // EXECUTE includes the phases of GC
+  enum phase {
+    EXECUTE, GC_COPY_ROOTS, GC_MARK_AND_COPY, GC_SWEEP,
+    NUM_PHASES
+  };
+
+  struct Values {
+    quint64 counts[NUM_COUNTERS];
+  };
+
+  KevesPerfCounters(const KevesPerfCounters&) = delete;
+  KevesPerfCounters(KevesPerfCounters&&) = delete;
+  KevesPerfCounters& operator=(const KevesPerfCounters&) = delete;
+  KevesPerfCounters& operator=(KevesPerfCounters&&) = delete;
+  ~KevesPerfCounters();
+
+  KevesPerfCounters();
+
+  // It must be called on the thread to be measured. The counters are opened
+  // as one group to be scheduled together, and those which are not
+  // supported are left out of it and read as 0.
+  bool open();
+
+  // Counts are scaled by the time the group was enabled over the time it
+  // was running, in case the PMU is multiplexed.
+  void read(Values* values) const;
+  void add(phase p, const Values& begin, const Values& end);
+
+  // for consecutive phases
+  void beginPhase() {
+    read(&last_);
+  }
+
+  void endPhase(phase p);
+
+  void report(std::ostream& out) const;
+
+private:
+  void closeAll();
+
+  int fds_[NUM_COUNTERS];
+  int slots_[NUM_COUNTERS]; // in the values of the group, or -1
+  int leader_;
+  Values totals_[NUM_PHASES];
+  Values last_;
+};
+
+// spans of all threads, written as JSON of Chrome trace events
+class KevesTimeline {
+public:
+  KevesTimeline() = delete;
+  KevesTimeline(const KevesTimeline&) = delete;
+  KevesTimeline(KevesTimeline&&) = delete;
+  KevesTimeline& operator=(const KevesTimeline&) = delete;
+  KevesTimeline& operator=(KevesTimeline&&) = delete;
+  ~KevesTimeline() = default;
+
+  explicit KevesTimeline(const QString& file_name);
+
+  // microseconds since the timeline started
+  double now() const {
+    return timer_.nsecsElapsed() / 1000.0;
+  }
+
+  // add a span on the current thread
+  void addSpan(const QString& name, const char* category,
+	       double begin, double end);
+
+  bool write() const;
+
+private:
+  struct Span {
+    QString name;
+    const char* category;
+    quintptr tid;
+    double begin;
+    double duration;
+  };
+
+  QElapsedTimer timer_;
+  mutable QMutex mutex_;
+  QVector<Span> spans_;
+  QString file_name_;
+};
+
+// Calls from the top-level code, such as the parser and the expander,
+// and the evaluation of expanded code are spans of a VM. A span ends when
+// a frame returns to the pc after its call.
+class KevesVMTimeline {
+public:
+  KevesVMTimeline() = delete;
+  KevesVMTimeline(const KevesVMTimeline&) = delete;
+  KevesVMTimeline(KevesVMTimeline&&) = delete;
+  KevesVMTimeline& operator=(const KevesVMTimeline&) = delete;
+  KevesVMTimeline& operator=(KevesVMTimeline&&) = delete;
+  ~KevesVMTimeline() = default;
+
+  KevesVMTimeline(KevesTimeline* timeline, KevesCommon* common);
+
+  double now() const {
+    return timeline_->now();
+  }
+
+  void addSpan(const QString& name, const char* category, double begin) {
+    timeline_->addSpan(name, category, begin, now());
+  }
+
+  void set_top_level(const CodeKev* code) {
+    top_level_ = code;
+  }
+
+  void call(KevesValue proc, const_KevesIterator return_pc);
+  void begin(const QString& name, const_KevesIterator return_pc);
+
+  void unwind(const_KevesIterator pc) {
+    if (!spans_.isEmpty() && spans_.last().return_pc == pc) endSpan();
+  }
+
+  void endAll() {
+    while (!spans_.isEmpty()) endSpan();
+  }
+
+private:
+  struct OpenSpan {
+    QString name;
+    const_KevesIterator return_pc;
+    double begin;
+  };
+
+  void endSpan();
+
+  KevesTimeline* timeline_;
+  KevesCommon* common_;
+  const CodeKev* top_level_;
+  QHash<const CodeKev*, QString> names_;
+  QVector<OpenSpan> spans_;
+};
+
+#ifdef KEVES_TRACE
+
+class KevesTrace {
+public:
+  static constexpr int SIZE = 4096; // a power of 2
+  static constexpr int MAX_TRACES = 64;
+
+  enum kind { INSTRUCT, CALL, GC_START, GC_END };
+
+  KevesTrace() = delete;
+  KevesTrace(const KevesTrace&) = delete;
+  KevesTrace(KevesTrace&&) = delete;
+  KevesTrace& operator=(const KevesTrace&) = delete;
+  KevesTrace& operator=(KevesTrace&&) = delete;
+  ~KevesTrace();
+
+  explicit KevesTrace(const KevesInstructTable* instruct_table);
+
+  void instruct(keves_instruct inst, const_KevesIterator pc, KevesValue acc) {
+    push(INSTRUCT, inst, &*pc, tagOf(acc));
+  }
+
+  void call(KevesValue proc, const_KevesIterator pc) {
+    push(CALL, tagOf(proc), &*pc, proc.toUIntPtr());
+  }
+
+  void gcStart(const_KevesIterator pc, size_t allocated_bytes) {
+    allocated_bytes_at_gc_ = allocated_bytes;
+    push(GC_START, 0, &*pc, allocated_bytes);
+  }
+
+  void gcEnd(size_t allocated_bytes) {
+    push(GC_END, 0, nullptr, allocated_bytes - allocated_bytes_at_gc_);
+  }
+
+  // They only write to fd, so they can be called in a signal handler.
+  void dump(int fd) const;
+  static void dumpAll(int fd);
+
+  // dump all the traces to stderr on signum
+  static bool installSignalHandler(int signum);
+
+private:
+  struct Entry {
+    quint8 kind;
+    quint16 data; // an instruction or a tag
+    const void* pc;
+    quintptr value;
+  };
+
+  // the type of a pointer or the tag of an immediate value
+  static quint16 tagOf(KevesValue value) {
+    return value.isPtr() ?
+      static_cast<quint16>(0x100 | value.type()) :
+      static_cast<quint16>(value.toUIntPtr() & 0xf);
+  }
+
+  // Only the VM thread writes, and readers see entries before index_.
+  void push(kind k, quint16 data, const void* pc, quintptr value) {
+    quint64 index(index_.load(std::memory_order_relaxed));
+    Entry& entry(entries_[index & (SIZE - 1)]);
+    entry.kind = k;
+    entry.data = data;
+    entry.pc = pc;
+    entry.value = value;
+    index_.store(index + 1, std::memory_order_release);
+  }
+
+  static void handleSignal(int);
+
+  Entry entries_[SIZE];
+  std::atomic<quint64> index_;
+  size_t allocated_bytes_at_gc_;
+  const KevesInstructTable* instruct_table_;
+  static std::atomic<KevesTrace*> traces_[MAX_TRACES];
+};
+
+#endif // KEVES_TRACE
@@ -178,6 +178,28 @@ namespace Function {
     return KevesVM::returnValue(vm, pc);
   }
 
+  // compare with a fast path for two fixnums, which COMPARE::funcFixnum
+  // compares directly. The arguments are still tested, only for fixnums
+  // first; any other call goes to compare.
+  template<class TEST, class COMPARE>
+  void compareFixnumFirst(KevesVM* vm, const_KevesIterator pc)
+  {
+    StackFrameKev* registers(&vm->registers_);
+
+    if (registers->argn() == 3) {
+      KevesValue lhs(registers->lastArgument(1));
+      KevesValue rhs(registers->lastArgument());
+
+      if (lhs.isFixnum() && rhs.isFixnum()) {
+	vm->acc_ = COMPARE::funcFixnum(KevesFixnum(lhs), KevesFixnum(rhs)) ?
+	  EMB_TRUE : EMB_FALSE;
+	return KevesVM::returnValue(vm, pc);
+      }
+    }
+
+    return compare<TEST, COMPARE>(vm, pc);
+  }
+
   template<class TEST, class COMPOSE>
   void compose(KevesVM* vm, const_KevesIterator pc)
   {
@@ -462,7 +484,17 @@ namespace Arithmatic {
     if (vm->gr1_.isFixnum()) {
       KevesFixnum num1(vm->gr1_);
       KevesFixnum num2(vm->acc_);
-      FIXNUM result(OPERATOR2::func(num1, num2));
+      FIXNUM result;
+
+      if (!OPERATOR2::func(num1, num2, &result)) {
+	// overflows FIXNUM itself, so calculate with GMP.
+	registers->popArgument();
+	RATIONAL rational(num2);
+	RationalNumberKev big_result(OPERATOR2::func(vm->gc(), rational, num1));
+	vm->acc_ = &big_result;
+	vm->gr1_ = registers->lastArgument();
+	return func2<OPERATOR1, OPERATOR2, FIXNUM, RATIONAL>(vm, pc);
+      }
 
       if (KevesFixnum::isInRange(result)) {
 	registers->popArgument();
@@ -572,10 +604,10 @@ namespace Arithmatic {
     }
 
     if (current.is<FlonumKev>()) {
-      const FlonumKev* num1(current);
-      FlonumKev result(OPERATOR2::func(*num1, *num2));
+      const FlonumKev num1(FlonumKev::fromKevesValue(current));
+      FlonumKev result(OPERATOR2::func(num1, *num2));
       registers->popArgument();
-      vm->acc_ = &result;
+      vm->acc_ = result.optimize();
       vm->gr1_ = registers->lastArgument();
       return func3<OPERATOR1, OPERATOR2>(vm, pc);
     }
@@ -640,39 +672,39 @@ namespace Arithmatic {
   void func3a(KevesVM* vm, const_KevesIterator pc)
   {
     StackFrameKev* registers(&vm->registers_);
-    const FlonumKev* num2(vm->acc_);
+    const FlonumKev num2(FlonumKev::fromKevesValue(vm->acc_));
     KevesValue current(vm->gr1_);
 
     if (current.isFixnum()) {
       KevesFixnum num1(current);
-      FlonumKev result(OPERATOR2::func(*num2, num1));
+      FlonumKev result(OPERATOR2::func(num2, num1));
       registers->popArgument();
-      vm->acc_ = &result;
+      vm->acc_ = result.optimize();
       vm->gr1_ = registers->lastArgument();
       return func3<OPERATOR1, OPERATOR2>(vm, pc);
     }
 
     if (current.is<RationalNumberKev>()) {
       const RationalNumberKev* num1(current);
-      FlonumKev result(OPERATOR2::func(*num2, *num1));
+      FlonumKev result(OPERATOR2::func(num2, *num1));
       registers->popArgument();
-      vm->acc_ = &result;
+      vm->acc_ = result.optimize();
       vm->gr1_ = registers->lastArgument();
       return func3<OPERATOR1, OPERATOR2>(vm, pc);
     }
 
     if (current.is<FlonumKev>()) {
-      const FlonumKev* num1(current);
-      FlonumKev result(OPERATOR2::func(*num1, *num2));
+      const FlonumKev num1(FlonumKev::fromKevesValue(current));
+      FlonumKev result(OPERATOR2::func(num1, num2));
       registers->popArgument();
-      vm->acc_ = &result;
+      vm->acc_ = result.optimize();
       vm->gr1_ = registers->lastArgument();
       return func3<OPERATOR1, OPERATOR2>(vm, pc);
     }
 
     if (current.is<ExactComplexNumberKev>()) {
       const ExactComplexNumberKev* num1(current);
-      InexactComplexNumberKev result(OPERATOR2::func(num1->toInexact(), *num2));
+      InexactComplexNumberKev result(OPERATOR2::func(num1->toInexact(), num2));
       registers->popArgument();
       vm->acc_ = &result;
       vm->gr1_ = registers->lastArgument();
@@ -681,7 +713,7 @@ namespace Arithmatic {
 
     if (current.is<InexactComplexNumberKev>()) {
       const InexactComplexNumberKev* num1(current);
-      InexactComplexNumberKev result(OPERATOR2::func(*num1, *num2));
+      InexactComplexNumberKev result(OPERATOR2::func(*num1, num2));
       registers->popArgument();
       vm->acc_ = &result;
       vm->gr1_ = registers->lastArgument();
@@ -752,8 +784,8 @@ namespace Arithmatic {
     }
 
     if (current.is<FlonumKev>()) {
-      const FlonumKev* num1(current);
-      InexactComplexNumberKev result(OPERATOR2::func(num2->toInexact(), *num1));
+      const FlonumKev num1(FlonumKev::fromKevesValue(current));
+      InexactComplexNumberKev result(OPERATOR2::func(num2->toInexact(), num1));
       registers->popArgument();
       vm->acc_ = &result;
       vm->gr1_ = registers->lastArgument();
@@ -831,14 +863,14 @@ namespace Arithmatic {
       const RationalNumberKev* num1(current);
       result.copyFrom(OPERATOR2::func(*num2, *num1));
     } else if (current.is<FlonumKev>()) {
-      const FlonumKev* num1(current);
-      result.copyFrom(OPERATOR2::func(*num2, *num1));
+      const FlonumKev num1(FlonumKev::fromKevesValue(current));
+      result.copyFrom(OPERATOR2::func(*num2, num1));
     } else if (current.is<ExactComplexNumberKev>()) {
       const ExactComplexNumberKev* num1(current);
-      result.copyFrom(OPERATOR2::func(*num2, *num1));
+      result.copyFrom(OPERATOR2::func(*num2, num1));
     } else if (current.is<InexactComplexNumberKev>()) {
       const InexactComplexNumberKev* num1(current);
-      result.copyFrom(OPERATOR2::func(*num2, *num1));
+      result.copyFrom(OPERATOR2::func(*num2, num1));
     } else {
       vm->acc_ = vm->gr2_;
       vm->gr1_ = KevesValue(vm->common()->getMesgText(KevesBuiltinValues::mesg_ReqNum));
@@ -19,16 +19,18 @@
 
 #pragma once
 
+#include <cstdint>
 #include <QtGlobal>
 
 typedef qint64 ioword;
 typedef quint64 uioword;
 typedef qint32 ver_num_t;
-typedef qint32 fx_int;
+typedef std::intptr_t fx_int; // a word wide, 62 bits are used on 64-bit targets
 typedef qint64 fx_long;
 
 
 class ArgumentFrameKev;
+class FlonumKev;
 class LocalVarFrameKev;
 // class FreeVarFrameKev;
 class StackFrameKev;
@@ -71,9 +73,9 @@ enum kev_type {
   TEMPLATE	= 023,		// 010 011
   CPS		= 024,		// 010 100
   LAMBDA	= 025,		// 010 101
-  // UNUSED   	= 026,		// 010 110
+  ESCAPE	= 026,		// 010 110
   CONTINUATION	= 027,		// 010 111
-  // UNUSED	= 030,
+  CONDITION_AST = 030,		// 011 000
   ARG_FRAME	= 031,
   LOCAL_FRAME	= 032,
   FREE_FRAME	= 033,
@@ -232,6 +234,7 @@ class KevesValue {
     ALIGN  = 0x3,
     REF    = 0x2, // ......10: reference to Kev for GC
     FIXNUM = 0x3, // ......11: KevesFixnum
+    FLOAT  = 0x1, // ....0001: KevesFlonum, only on 64-bit targets
     INST   = 0x5, // 00000101: KevesInstruct
     CHAR   = 0xd  // 00001101: KevesChar
   };
@@ -277,14 +280,16 @@ public:
   }
 
   bool isComplexNumber() const {
-    return isFixnum() ||
+    return isFixnum() || isFlonum() ||
       (isPtr() && (type() | (RATIONAL_NUM ^ INEX_CPLX_NUM)) == INEX_CPLX_NUM);
     // (isPtr() && ((type() | (RATIONAL_NUM ^ EXCT_CPLX_NUM)) == EXCT_CPLX_NUM ||
     // type() == INEX_CPLX_NUM));
   }
 
   bool isCondition() const {
-    return isPtr() && (type() | (CONDITION_SMP ^ CONDITION_CMP)) == CONDITION_CMP;
+    return isPtr() &&
+      ((type() | (CONDITION_SMP ^ CONDITION_CMP)) == CONDITION_CMP ||
+       type() == CONDITION_AST);
   }
 
   bool isDestination() const {
@@ -301,7 +306,8 @@ public:
   }
 
   bool isInexactNumber() const {
-    return isPtr() && (type() | (FLONUM ^ INEX_CPLX_NUM)) == INEX_CPLX_NUM;
+    return isFlonum() ||
+      (isPtr() && (type() | (FLONUM ^ INEX_CPLX_NUM)) == INEX_CPLX_NUM);
   }
   
   bool isJump() const {
@@ -313,7 +319,7 @@ public:
   }
 
   bool isNumber() const {
-    return isFixnum() ||
+    return isFixnum() || isFlonum() ||
       (isPtr() && (type() | (RATIONAL_NUM ^ INEX_CPLX_NUM)) == INEX_CPLX_NUM);
   }
 
@@ -342,6 +348,14 @@ public:
     return (val_ & ALIGN) == FIXNUM; // 11
   }
   
+  bool isFlonum() const { // see value/flonum.hpp
+#if QT_POINTER_SIZE == 8
+    return (val_ & 0xf) == FLOAT; // 0001
+#else
+    return false;
+#endif
+  }
+  
   bool isInstruct() const { // see keves_instruct.hpp
     return (val_ & 0xff) == INST; // 0000 0101
   }
@@ -355,7 +369,7 @@ public:
   }
 
   bool isRealNumber() const {
-    return isFixnum() ||
+    return isFixnum() || isFlonum() ||
       (isPtr() && (type() | (RATIONAL_NUM ^ FLONUM)) == FLONUM);
   }
 
@@ -430,6 +444,13 @@ protected:
   quintptr val_ = 0;
 };
 
+// A flonum is either a KevesFlonum or a boxed FlonumKev. This is declared
+// here, before any use of is<FlonumKev>(), so every translation unit sees
+// the same specialization.
+template<> inline bool KevesValue::is<FlonumKev>() {
+  return isFlonum() || (isPtr() && type() == FLONUM);
+}
+
 class MutableKevesValue : public KevesValue {
 public:
   MutableKevesValue() = default;
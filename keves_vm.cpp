@@ -19,10 +19,13 @@
 
 #include "keves_vm.hpp"
 
-#include <iostream>
+#include <algorithm>
+#include <unistd.h>
 #include "keves_builtin_values.hpp"
 #include "keves_common.hpp"
 #include "keves_library.hpp"
+#include "keves_log.hpp"
+#include "keves_profile.hpp"
 #include "keves_stack.hpp"
 #include "keves_textual_port.hpp"
 #include "kev/bignum.hpp"
@@ -66,8 +69,30 @@ KevesVM* KevesVM::make(KevesCommon* common, KevesTextualOutputPort* result_field
   return vm;
 }
 
+KevesVM::~KevesVM() {
+  delete profile_;
+  delete sampler_;
+  delete call_profile_;
+  delete alloc_profile_;
+  delete timeline_;
+  delete perf_counters_;
+  delete code_counters_;
+
+#ifdef KEVES_TRACE
+  delete trace_;
+#endif
+}
+
 void KevesVM::run() {
+  if (!timeline_) {
+    execute();
+    return;
+  }
+
+  double begin(timeline_->now());
   execute();
+  timeline_->endAll();
+  timeline_->addSpan("run", "vm", begin);
 }
   
 void KevesVM::checkStack(size_t* size, vm_func func, const_KevesIterator pc) {
@@ -90,7 +115,7 @@ void KevesVM::makeRectangular(KevesVM* vm, const_KevesIterator pc) {
   if (real.isRealNumber() && imag.isRealNumber()) {
     if (real.isFixnum()) {
       KevesFixnum fixnum(real);
-      RationalNumberKevFromInt real_part(fixnum);
+      RationalNumberKevFromLong real_part(fixnum);
 
       if (imag.isFixnum()) {
 	KevesFixnum fixnum(imag);
@@ -100,7 +125,7 @@ void KevesVM::makeRectangular(KevesVM* vm, const_KevesIterator pc) {
 	  return returnValueSafe(vm, pc);
 	}
 	
-	RationalNumberKevFromInt imag_part(fixnum);
+	RationalNumberKevFromLong imag_part(fixnum);
 	ExactComplexNumberKev complex(real_part, imag_part);
 	vm->acc_ = &complex;
 	return returnValueSafe(vm, pc);
@@ -121,8 +146,8 @@ void KevesVM::makeRectangular(KevesVM* vm, const_KevesIterator pc) {
       
       {
 	FlonumKev real_part(fixnum);
-	const FlonumKev* imag_part(imag);
-	InexactComplexNumberKev complex(real_part, *imag_part);
+	const FlonumKev imag_part(FlonumKev::fromKevesValue(imag));
+	InexactComplexNumberKev complex(real_part, imag_part);
 	vm->acc_ = &complex;
 	return returnValueSafe(vm, pc);
       }
@@ -139,7 +164,7 @@ void KevesVM::makeRectangular(KevesVM* vm, const_KevesIterator pc) {
 	  return returnValueSafe(vm, pc);
 	}
 	
-	RationalNumberKevFromInt imag_part(fixnum);
+	RationalNumberKevFromLong imag_part(fixnum);
 	ExactComplexNumberKev complex(*real_part, imag_part);
 	vm->acc_ = &complex;
 	return returnValueSafe(vm, pc);
@@ -159,18 +184,18 @@ void KevesVM::makeRectangular(KevesVM* vm, const_KevesIterator pc) {
       }
       
       FlonumKev flonum(real_part->toInexact());
-      const FlonumKev* imag_part(imag);
-      InexactComplexNumberKev complex(flonum, *imag_part);
+      const FlonumKev imag_part(FlonumKev::fromKevesValue(imag));
+      InexactComplexNumberKev complex(flonum, imag_part);
       vm->acc_ = &complex;
       return returnValueSafe(vm, pc);
     }
     
-    const FlonumKev* real_part(real);
+    const FlonumKev real_part(FlonumKev::fromKevesValue(real));
     
     if (imag.isFixnum()) {
       KevesFixnum fixnum(imag);
       FlonumKev imag_part(fixnum);
-      InexactComplexNumberKev complex(*real_part, imag_part);
+      InexactComplexNumberKev complex(real_part, imag_part);
       vm->acc_ = &complex;
       return returnValueSafe(vm, pc);
     }
@@ -178,13 +203,13 @@ void KevesVM::makeRectangular(KevesVM* vm, const_KevesIterator pc) {
     if (imag.is<RationalNumberKev>()) {
       const RationalNumberKev* rational(imag);
       FlonumKev imag_part(rational->toInexact());
-      InexactComplexNumberKev complex(*real_part, imag_part);
+      InexactComplexNumberKev complex(real_part, imag_part);
       vm->acc_ = &complex;
       return returnValueSafe(vm, pc);
     }
     
-    const FlonumKev* imag_part(imag);
-    InexactComplexNumberKev complex(*real_part, *imag_part);
+    const FlonumKev imag_part(FlonumKev::fromKevesValue(imag));
+    InexactComplexNumberKev complex(real_part, imag_part);
     vm->acc_ = &complex;
     return returnValueSafe(vm, pc);
   }
@@ -221,6 +246,11 @@ const StringKev* KevesVM::makeString(int size, QChar chr) {
   return string;
 }
 
+StringKev* KevesVM::makeString(const QString& str) {
+  StringKev* string(StringKev::make(&this->gc_, str));
+  return string;
+}
+
 // for vectors
 VectorKev* KevesVM::makeVector(int size) {
   VectorKev* vector(VectorKev::make(&this->gc_, size));
@@ -242,6 +272,7 @@ void KevesVM::cmd_NOP(KevesVM* vm, const_KevesIterator pc) {
   vm->checkStack(&dummy, &cmd_NOP, pc);
 #endif
 
+  KEVES_TRACE_EVENT(vm, instruct(KevesInstruct(*pc), pc, vm->acc_));
   return (vm->cmd_table_[KevesInstruct(*pc)])(vm, pc + 1);
 }
 
@@ -252,6 +283,9 @@ void KevesVM::cmd_JUMP(KevesVM* vm, const_KevesIterator pc) {
   
 void KevesVM::cmd_JUMP_R(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum offset(*pc);
+
+  if (offset < 0 && vm->code_counters_) vm->countBackEdge(pc);
+
   return cmd_NOP(vm, pc + offset + 1);
 }
   
@@ -312,25 +346,45 @@ void KevesVM::pushAccToArgument(KevesVM* vm, const_KevesIterator pc) {
 }
 
 void KevesVM::returnValue(KevesVM* vm, const_KevesIterator) {
-  return pushAccToArgument(vm, vm->registers_.unwind());
+  return pushAccToArgument(vm, vm->unwindFrame());
   // return pushAccToArgumentSafe(vm, registers->unwind());
 }
 
 void KevesVM::returnValueSafe(KevesVM* vm, const_KevesIterator) {
-  return pushAccToArgumentSafe(vm, vm->registers_.unwind());
+  return pushAccToArgumentSafe(vm, vm->unwindFrame());
 }
 
-void KevesVM::returnTwoValues(KevesVM* vm, const_KevesIterator pc) {
-  ArgumentFrameKevWithArray<04> arg_frame;
-
-  vm->checkStack(&arg_frame, &returnTwoValues, pc);
-  
-  arg_frame.assign(0, KevesFixnum(3));
-  arg_frame.assign(1, vm->acc_);
-  arg_frame.assign(2, vm->gr1_);
-  vm->keves_vals_ = &arg_frame;
+void KevesVM::returnTwoValues(KevesVM* vm, const_KevesIterator) {
+  vm->vals_[0] = vm->acc_;
+  vm->vals_[1] = vm->gr1_;
+  vm->valn_ = 2;
   vm->gr1_ = vm->acc_;
-  return pushGr1ToArgument(vm, vm->registers_.unwind());
+  return pushGr1ToArgument(vm, vm->unwindFrame());
+}
+
+// keep arguments from 1 to argn - 1 of the frame as multiple values
+void KevesVM::keepValues(ArgumentFrameKev* frame, int argn) {
+  valn_ = argn - 1;
+
+  if (valn_ > VALS_SIZE) {
+    keves_vals_ = frame;
+    keves_vals_->assign(0, KevesFixnum(argn));
+    return;
+  }
+
+  const KevesValue* iter(frame->array() + 1);
+  std::copy(iter, iter + valn_, vals_);
+}
+
+// the value returned last is the only one if valn_ is 0
+KevesValue KevesVM::valueAt(int index) const {
+  if (valn_ == 0)
+    return registers_.lastArgument();
+
+  if (valn_ > VALS_SIZE)
+    return keves_vals_->at(index + 1);
+
+  return vals_[index];
 }
 
 void KevesVM::continueRationalNumberKev(KevesVM* vm,
@@ -383,7 +437,10 @@ void KevesVM::returnExactComplexNumberKev(KevesVM* vm, const_KevesIterator pc) {
 }
 
 void KevesVM::executeGC(vm_func current_func, const_KevesIterator pc) {
-  std::cout << "start GC" << std::endl;
+  KEVES_LOG(KEVES_LOG_DEBUG) << "start GC";
+  in_gc_ = true;
+  KEVES_TRACE_EVENT(this, gcStart(pc, gc_.allocated_bytes()));
+  if (call_profile_) call_profile_->saveFrames(&registers_);
   current_function_ = current_func;
   return gc_.execute(pc);
 }
@@ -397,9 +454,33 @@ int KevesVM::execute() {
   stack_higher_limit_ = static_cast<char*>(stack_lower_limit_) + stack_size;
   stack_safety_limit_ = static_cast<char*>(stack_lower_limit_) + 1024 * 1024;
   stack_higher_limit_ = reinterpret_cast<char*>(&attr);
-  std::cout << "higher limit: " << stack_higher_limit_ << std::endl;
 
-  return execute_helper();
+  if (nursery_size_ > 0) {
+    char* nursery_limit(static_cast<char*>(stack_higher_limit_) - nursery_size_);
+
+    if (nursery_limit > stack_safety_limit_)
+      stack_safety_limit_ = nursery_limit;
+  }
+
+  KEVES_LOG(KEVES_LOG_DEBUG) << "higher limit: " << stack_higher_limit_;
+
+  if (!perf_counters_) return execute_helper();
+
+  // report them after the statistics of GC
+  perf_counters_->open();
+  KevesPerfCounters::Values begin;
+  perf_counters_->read(&begin);
+  int result(execute_helper());
+  KevesPerfCounters::Values end;
+  perf_counters_->read(&end);
+  perf_counters_->add(KevesPerfCounters::EXECUTE, begin, end);
+
+  if (KevesLog::isEnabled(KEVES_LOG_INFO)) {
+    KevesLog log(KEVES_LOG_INFO);
+    perf_counters_->report(log.stream());
+  }
+
+  return result;
 }
 
 int KevesVM::execute_helper() {
@@ -407,36 +488,39 @@ int KevesVM::execute_helper() {
   registers_.set_fp(&registers_);
 
   registers_.changeToBottomFrame();
-  QStringList library_name;
-  library_name << "keves" << "base";
+  QStringList library_name(main_library_);
+  if (library_name.isEmpty()) library_name << "keves" << "base";
   QList<ver_num_t> ver_num;
-  KevesLibrary* lib_keves_base(common_->getLibrary(library_name, ver_num));
+  KevesLibrary* lib_main(common_->getLibrary(library_name, ver_num));
 
-  if (!lib_keves_base) {
+  if (!lib_main) {
     KevesLibrary::errorOfMissingLibrary(library_name, ver_num);
     return 1;
   }
   
-  KevesValue code(lib_keves_base->findBind("my-code"));
+  KevesValue code(lib_main->findBind("my-code"));
 
   if (code == EMB_UNDEF) {
-    std::cerr << "bind: my-code is not found!!!\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "bind: my-code is not found!!!";
     return 1;
   } else if (!code.isCode()) {
-    std::cerr << "my-code is not code!!!\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "my-code is not code!!!";
     return 1;
   }
   
-  const_KevesIterator pc(code.toPtr<CodeKev>()->begin());
+  current_code_ = code.toPtr<CodeKev>();
+  if (timeline_) timeline_->set_top_level(current_code_);
+  if (code_counters_) countEntry(current_code_);
+  const_KevesIterator pc(current_code_->begin());
   Q_ASSERT(pc->isInstruct());
 
-  KevesValue environment(lib_keves_base->findBind("environment"));
+  KevesValue environment(lib_main->findBind("environment"));
 
   if (environment == EMB_UNDEF) {
-    std::cerr << "bind: environment is not found!!!\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "bind: environment is not found!!!";
     return 1;
   } else if (!environment.is<EnvironmentKev>()) {
-    std::cerr << "environment is not environment!!!\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "environment is not environment!!!";
     return 1;
   }
   
@@ -455,26 +539,59 @@ int KevesVM::execute_helper() {
   LocalVarFrameKev clsr;
   registers_.setClosure(&clsr);
   keves_vals_ = nullptr;
+  valn_ = 0;
   gr1_ = gr2_ = gr3_ = EMB_UNDEF; // acc_ keeps value
   
   current_function_ = cmd_table_[KevesInstruct(*pc++)];
   current_pc_ = pc;
   
-  std::cout << "&arg_frame: " << &arg_frame << std::endl;
-  std::cout << "stack_higher_limit_: " << stack_higher_limit_ << std::endl;
+  KEVES_LOG(KEVES_LOG_DEBUG) << "&arg_frame: " << &arg_frame;
+  KEVES_LOG(KEVES_LOG_DEBUG) << "stack_higher_limit_: " << stack_higher_limit_;
   
   Q_ASSERT(&registers_ < stack_lower_limit_ || &registers_ >= stack_higher_limit_);
   
+  // the timer counts the CPU time of this thread, so it starts here
+  if (sampler_ && !sampler_->start())
+    KEVES_LOG(KEVES_LOG_WARNING) << "KevesVM: could not start the sampling timer";
+
   switch(setjmp(jmp_exit_)) {
   case -2:
-    std::cerr << "KevesVM: fatal error\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "KevesVM: fatal error";
+    if (sampler_) sampler_->stop();
+    dumpTrace();
     return 1;
 
   case -1:
-    std::cout << "gc time: " << gc_.getElapsedTime() << std::endl;
+    // HALT returns for each top-level form, so profiles end only here
+    if (profile_) profile_->write(common_->instruct_table());
+    if (code_counters_) code_counters_->write(common_);
+
+    if (sampler_) {
+      sampler_->stop();
+      sampler_->write(common_);
+    }
+
+    if (alloc_profile_) alloc_profile_->write(common_);
+
+    // the calls still open are those of the outermost forms
+    if (call_profile_) {
+      call_profile_->leaveAll();
+      call_profile_->write(common_);
+    }
+
+    KEVES_LOG(KEVES_LOG_INFO) << "gc time: " << gc_.getElapsedTime();
+    KevesLog::flush();
     return 0;
 
   default:
+    if (in_gc_) {
+      KEVES_TRACE_EVENT(this, gcEnd(gc_.allocated_bytes()));
+      // a sample requested while collecting is of GC
+      if (sampler_ && sampler_->pending()) sampler_->recordGC();
+    }
+
+    in_gc_ = false;
+    if (call_profile_) call_profile_->restoreFrames(&registers_);
     (*current_function_)(this, current_pc_);
     return -1; // normally, not arrive here
   }
@@ -495,13 +612,27 @@ void KevesVM::cmd_HALT(KevesVM* vm, const_KevesIterator pc) {
       return returnValue(vm, pc);
     }
     
-    std::cerr << "KevesVM::cmd_HALT(): Not handle global values properly\n";
+    KEVES_LOG(KEVES_LOG_ERROR) << "KevesVM::cmd_HALT(): Not handle global values properly";
     longjmp(vm->jmp_exit_, -2);
   }
 
+  // The result is left in acc_, which must not be in eden on the stack
+  // of execute() to be read after it.
+  vm->acc_ = temp;
+  if (vm->isInEden(temp)) return vm->executeGC(&exitWithResult, pc);
+  return exitWithResult(vm, pc);
+}
+
+void KevesVM::exitWithResult(KevesVM* vm, const_KevesIterator) {
   longjmp(vm->jmp_exit_, -1);
 }
 
+bool KevesVM::isInEden(KevesValue value) const {
+  return value.isPtr()
+    && static_cast<const void*>(value.toPtr()) >= stack_lower_limit_
+    && static_cast<const void*>(value.toPtr()) < stack_higher_limit_;
+}
+
 void KevesVM::cmd_TEST(KevesVM* vm, const_KevesIterator pc) {
   return (vm->acc_ != EMB_FALSE ? cmd_SKIP : cmd_JUMP)(vm, pc);
 }
@@ -583,6 +714,30 @@ void KevesVM::cmd_FRAME_R(KevesVM* vm, const_KevesIterator pc) {
   return cmd_NOP(vm, pc + 1);
 }
 
+// Operands are the offset to the return point and the frame size, that is
+// the number of arguments plus one for the procedure.
+void KevesVM::cmd_FRAME_N_R(KevesVM* vm, const_KevesIterator pc) {
+  KevesFixnum size(*(pc + 1));
+
+  return
+    size <= 8 ? windArgumentFrame<010>(vm, pc) :
+    size <= 16 ? windArgumentFrame<020>(vm, pc) :
+    windArgumentFrame<040>(vm, pc); // larger frames are extended
+}
+
+template<int SIZE>
+void KevesVM::windArgumentFrame(KevesVM* vm, const_KevesIterator pc) {
+  ArgumentFrameKevWithArray<SIZE> arg_frame;
+
+  vm->checkStack(&arg_frame, &windArgumentFrame<SIZE>, pc);
+
+  StackFrameKev stack_frame;
+  KevesFixnum offset(*pc);
+  vm->registers_.wind(pc + offset + 2, &stack_frame, &arg_frame);
+
+  return cmd_NOP(vm, pc + 2);
+}
+
 void KevesVM::cmd_SFRAME(KevesVM* vm, const_KevesIterator pc) {
   ArgumentFrameKevWithArray<04> arg_frame;
 
@@ -610,32 +765,217 @@ void KevesVM::cmd_APPLY_CONSTANT(KevesVM* vm, const_KevesIterator pc) {
 
 void KevesVM::applyProcedure(KevesVM* vm, const_KevesIterator pc) {
   KevesValue proc(vm->gr1_);
+  KEVES_TRACE_EVENT(vm, call(proc, pc));
+  if (vm->timeline_) vm->timeline_->call(proc, vm->registers_.fp()->pc());
 
   if (proc.isPtr()) {
-    vm->keves_vals_ = nullptr;
+    vm->valn_ = 0;
     kev_type type(proc.type());
 
     if (type == CPS) {
       const CPSKev* cps(proc);
       vm->gr2_ = cps->who();
+
+      if (vm->call_profile_)
+	vm->call_profile_->enter(cps->who(), nullptr, vm->registers_.fp());
+
       return (*cps->func())(vm, pc);
     }
 
     if (type == LAMBDA) {
       const LambdaKev* lambda(proc);
-      vm->acc_ = proc;
-      const CodeKev* code(lambda->code());
-      vm->current_code_ = code;
+      vm->beginLambda(lambda);
       return cmd_NOP(vm, lambda->proc());
     }
 
     if (type == CONTINUATION)
       return cmd_UNWIND_CONTINUATION(vm, pc);
+
+    if (type == ESCAPE)
+      return unwindEscape(vm, pc);
   }
 
   return raiseAssertFirstObjNotProc(vm, pc);
 }
 
+void KevesVM::beginLambda(const LambdaKev* lambda) {
+  acc_ = lambda;
+  const CodeKev* code(lambda->code());
+  current_code_ = code;
+  if (code_counters_) countEntry(code);
+
+  if (call_profile_)
+    call_profile_->enter(EMB_NULL, code, registers_.fp());
+}
+
+void KevesVM::startProfile(const QString& file_name) {
+  delete profile_;
+  profile_ = new KevesProfile(file_name);
+  cmd_table_ = instrumentedTable();
+}
+
+void KevesVM::startSampling(const QString& file_name, int hz) {
+  delete sampler_;
+  sampler_ = new KevesSampler(file_name, hz);
+  cmd_table_ = instrumentedTable();
+}
+
+void KevesVM::startTrace() {
+#ifdef KEVES_TRACE
+  delete trace_;
+  trace_ = new KevesTrace(common_->instruct_table());
+  KevesTrace::installSignalHandler(SIGUSR2);
+#endif
+}
+
+void KevesVM::dumpTrace() const {
+#ifdef KEVES_TRACE
+  if (trace_) trace_->dump(STDERR_FILENO);
+#endif
+}
+
+void KevesVM::startCallProfile(const QString& file_name) {
+  delete call_profile_;
+  call_profile_ = new KevesCallProfile(file_name);
+}
+
+void KevesVM::startAllocProfile(const QString& file_name) {
+  delete alloc_profile_;
+  alloc_profile_ = new KevesAllocProfile(file_name, &running_pc_);
+  cmd_table_ = instrumentedTable();
+  gc_.set_alloc_profile(alloc_profile_);
+}
+
+void KevesVM::startPerfCounters() {
+  delete perf_counters_;
+  perf_counters_ = new KevesPerfCounters();
+  gc_.set_perf_counters(perf_counters_);
+}
+
+void KevesVM::startTimeline(KevesTimeline* timeline) {
+  delete timeline_;
+  timeline_ = new KevesVMTimeline(timeline, common_);
+  gc_.set_timeline(timeline);
+}
+
+const_KevesIterator KevesVM::unwindFrameOnTimeline() {
+  const_KevesIterator pc(registers_.unwind());
+  timeline_->unwind(pc);
+  return pc;
+}
+
+void KevesVM::leaveCalls() {
+  call_profile_->leave(registers_.fp());
+}
+
+// The profiles which need every instruction share one dispatch table, of
+// which every entry is countInstruct. It runs the hooks of the profiles
+// which are on, then the instruction from the table of KevesCommon.
+vm_func* KevesVM::instrumentedTable() {
+  static struct Table {
+    Table() {
+      std::fill_n(funcs, END_OF_LIST, &countInstruct);
+    }
+
+    vm_func funcs[END_OF_LIST];
+  } table;
+
+  return table.funcs;
+}
+
+void KevesVM::countInstruct(KevesVM* vm, const_KevesIterator pc) {
+  // a sample is taken between instructions, in the one which was running
+  // when SIGPROF came
+  if (vm->sampler_ && vm->sampler_->pending())
+    vm->sampler_->record(const_KevesIterator(vm->running_pc_), &vm->registers_);
+
+  vm->running_pc_ = &*(pc - 1);
+  KevesInstruct inst(*(pc - 1));
+  if (vm->profile_) vm->profile_->countInstruct(inst);
+  return (vm->common_->cmd_table()[inst])(vm, pc);
+}
+
+void KevesVM::set_tier_up(tier_up_func func,
+			  quint32 entry_threshold,
+			  quint32 back_edge_threshold) {
+  tier_up_ = func;
+  entry_threshold_ = entry_threshold;
+  back_edge_threshold_ = back_edge_threshold;
+
+  if (!code_counters_ && func && (entry_threshold > 0 || back_edge_threshold > 0))
+    startCodeCounters(QString());
+}
+
+void KevesVM::startCodeCounters(const QString& file_name) {
+  delete code_counters_;
+  code_counters_ = new KevesCodeCounters(file_name);
+  gc_.set_code_counters(code_counters_);
+}
+
+void KevesVM::countEntry(const CodeKev* code) {
+  KevesCodeCounters::Counter* counter(code_counters_->enter(code));
+
+  if (++counter->entries == entry_threshold_ && tier_up_)
+    (*tier_up_)(this, gc_.toMutable(code));
+}
+
+// The code is found from pc, since current_code_ is not restored when a
+// frame returns.
+void KevesVM::countBackEdge(const_KevesIterator pc) {
+  KevesCodeCounters::Counter* counter(code_counters_->find(pc));
+
+  if (counter && ++counter->back_edges == back_edge_threshold_ && tier_up_)
+    (*tier_up_)(this, gc_.toMutable(counter->code));
+}
+
+// a tier-up function which only reports hot code
+void KevesVM::reportHotCode(KevesVM* vm, CodeKev* code) {
+  KevesCodeCounters::Counter* counter(vm->code_counters_->enter(code));
+
+  KEVES_LOG(KEVES_LOG_INFO) << "hot code: " << static_cast<const void*>(code)
+			    << ", size: " << code->size()
+			    << ", entries: " << counter->entries
+			    << ", back edges: " << counter->back_edges;
+}
+
+// Apply the procedure at pc to the last two arguments, as FRAME_R,
+// PUSH_CONSTANT and APPLY would do, and return to pc + 1.
+void KevesVM::applyBinaryProcedure(KevesVM* vm, const_KevesIterator pc) {
+  ArgumentFrameKevWithArray<04> arg_frame;
+
+  vm->checkStack(&arg_frame, &applyBinaryProcedure, pc);
+
+  StackFrameKev* registers(&vm->registers_);
+  KevesValue arg1(registers->lastArgument());
+  KevesValue arg0(registers->lastArgument(1));
+  registers->popArgument();
+  registers->popArgument();
+
+  StackFrameKev stack_frame;
+  registers->wind(pc + 1, &stack_frame, &arg_frame);
+  vm->gr1_ = *pc;
+  registers->pushArgument(vm->gr1_);
+  registers->pushArgument(arg0);
+  registers->pushArgument(arg1);
+  return applyProcedure(vm, pc + 1);
+}
+
+// apply the procedure at pc to gr1_ and gr2_, and return to pc + 1
+void KevesVM::applyBinaryProcedureToRegisters(KevesVM* vm, const_KevesIterator pc) {
+  ArgumentFrameKevWithArray<04> arg_frame;
+
+  vm->checkStack(&arg_frame, &applyBinaryProcedureToRegisters, pc);
+
+  StackFrameKev* registers(&vm->registers_);
+  StackFrameKev stack_frame;
+  registers->wind(pc + 1, &stack_frame, &arg_frame);
+  registers->pushArgument(*pc);
+  registers->pushArgument(vm->gr1_);
+  registers->pushArgument(vm->gr2_);
+  vm->gr1_ = *pc;
+  return applyProcedure(vm, pc + 1);
+}
+
 void KevesVM::raiseAssertFirstObjNotProc(KevesVM* vm, const_KevesIterator pc) {
   vm->acc_ = vm->common_->builtin()->sym_eval();
   vm->gr2_ = vm->gr1_;
@@ -643,6 +983,13 @@ void KevesVM::raiseAssertFirstObjNotProc(KevesVM* vm, const_KevesIterator pc) {
   return raiseAssertCondition(vm, pc);
 }
 
+void KevesVM::raiseAssertEscapeExpired(KevesVM* vm, const_KevesIterator pc) {
+  vm->acc_ = vm->common_->builtin()->sym_eval();
+  vm->gr2_ = vm->gr1_;
+  vm->gr1_ = vm->common_->getMesgText(KevesBuiltinValues::mesg_EscapeExpired);
+  return raiseAssertCondition(vm, pc);
+}
+
 void KevesVM::cmd_CALL_LAMBDA(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev* registers(&vm->registers_);
   KevesFixnum num_arg(*pc);
@@ -652,8 +999,7 @@ void KevesVM::cmd_CALL_LAMBDA(KevesVM* vm, const_KevesIterator pc) {
   int argn(registers->argn());
 
   if (argn == num_arg + 1) {
-    registers->makeEnvFrame(&vm->gc_, num_arg);
-    registers->setArgumentsToLocalVars();
+    registers->makeEnvFrameWithArguments(&vm->gc_);
     return cmd_CALL_LAMBDA_helper(vm, pc);
   }
 
@@ -687,29 +1033,42 @@ void KevesVM::cmd_CALL_LAMBDA_VLA(KevesVM* vm, const_KevesIterator pc) {
     registers->assignLocalVar(idx, registers->argument(idx + 1));
   }
   
-  vm->gr1_ = EMB_NULL;
-  vm->gr2_ = KevesFixnum(num_arg_in_list);
-
-  return cmd_CALL_LAMBDA_VLA_helper(vm, pc);
+  // The rest list is built at once, with a single stack check.
+  return
+    num_arg_in_list <= 4 ? makeRestList<04>(vm, pc) :
+    num_arg_in_list <= 16 ? makeRestList<020>(vm, pc) :
+    num_arg_in_list <= 64 ? makeRestList<0100>(vm, pc) :
+    makeRestListInTenured(vm, pc);
 }
 
-void KevesVM::cmd_CALL_LAMBDA_VLA_helper(KevesVM* vm, const_KevesIterator pc) {
+template<int SIZE>
+void KevesVM::makeRestList(KevesVM* vm, const_KevesIterator pc) {
+  PairKev pairs[SIZE];
+
+  vm->checkStack(pairs, &makeRestList<SIZE>, pc);
+
   StackFrameKev* registers(&vm->registers_);
-  KevesFixnum num_arg_in_list(vm->gr2_);
   KevesFixnum num_arg(*pc);
+  KevesValue list(EMB_NULL);
+
+  for (int idx(registers->argn() - 1), i(0); idx > num_arg; --idx, ++i) {
+    pairs[i].set(registers->argument(idx), list);
+    list = &pairs[i];
+  }
+
+  registers->assignLocalVar(num_arg, list);
+  return cmd_CALL_LAMBDA_helper(vm, pc);
+}
 
-  if (num_arg_in_list > 0) {
-    KevesValue temp(registers->argument(num_arg_in_list + num_arg));
-    PairKev pair(temp, vm->gr1_);
+void KevesVM::makeRestListInTenured(KevesVM* vm, const_KevesIterator pc) {
+  StackFrameKev* registers(&vm->registers_);
+  KevesFixnum num_arg(*pc);
+  KevesValue list(EMB_NULL);
 
-    vm->checkStack(&pair, &cmd_CALL_LAMBDA_VLA_helper, pc);
+  for (int idx(registers->argn() - 1); idx > num_arg; --idx)
+    list = PairKev::make(&vm->gc_, registers->argument(idx), list);
 
-    vm->gr1_ = &pair;
-    vm->gr2_ = KevesFixnum(num_arg_in_list - 1);
-    return cmd_CALL_LAMBDA_VLA_helper(vm, pc);
-  }
-  
-  registers->assignLocalVar(num_arg, vm->gr1_);
+  registers->assignLocalVar(num_arg, list);
   return cmd_CALL_LAMBDA_helper(vm, pc);
 }
 
@@ -729,33 +1088,104 @@ void KevesVM::raiseAssertLambdaReqMore(KevesVM* vm, const_KevesIterator pc) {
 
 void KevesVM::cmd_APPLY_MULT(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev* registers(&vm->registers_);
+  int valn(vm->valn_);
 
-  if (vm->keves_vals_) {
+  if (valn > VALS_SIZE) {
     KevesValue first_obj(registers->argument(0));
-    registers->setArgFrame(vm->keves_vals_, KevesFixnum(vm->keves_vals_->at(0)));
+    registers->setArgFrame(vm->keves_vals_, valn + 1);
     registers->replaceFirstArgument(first_obj);
+  } else if (valn > 1) {
+    // the first value has been pushed already
+    while (registers->argn() + valn - 1 > registers->argp()->size())
+      registers->extendArgFrame(&vm->gc_);
+
+    for (int i(1); i < valn; ++i) registers->pushArgument(vm->vals_[i]);
   }
 
+  vm->valn_ = 0;
   return cmd_NOP(vm, pc);
 }
 
+// Apply in tail position without winding a frame. The operand is the number
+// of the last arguments holding the procedure and its arguments; they are
+// moved to the bottom of the current frame, so the callee returns directly
+// to the current caller.
+void KevesVM::cmd_TAIL_APPLY(KevesVM* vm, const_KevesIterator pc) {
+  StackFrameKev* registers(&vm->registers_);
+  KevesFixnum frame_size(*pc);
+  registers->moveLastArguments(frame_size, 0);
+  vm->gr1_ = registers->argument(0);
+  return applyProcedure(vm, pc + 1);
+}
+
+// Operands are the procedure and the number of the last arguments passed to it.
+void KevesVM::cmd_TAIL_APPLY_CONSTANT(KevesVM* vm, const_KevesIterator pc) {
+  StackFrameKev* registers(&vm->registers_);
+  KevesFixnum num_arg(*(pc + 1));
+
+  if (num_arg >= registers->argp()->size()) registers->extendArgFrame(&vm->gc_);
+
+  registers->moveLastArguments(num_arg, 1);
+  vm->gr1_ = *pc;
+  registers->replaceFirstArgument(vm->gr1_);
+  return applyProcedure(vm, pc + 2);
+}
+
+// APPLY_LAMBDA and TAIL_APPLY_LAMBDA are APPLY and TAIL_APPLY_CONSTANT
+// for a call site which knows its procedure: a LambdaKev whose code begins
+// with CALL_LAMBDA for the number of arguments passed. They bind to the
+// body after the CALL_LAMBDA, so the type of the procedure and the number
+// of the arguments are not checked again.
+void KevesVM::cmd_APPLY_LAMBDA(KevesVM* vm, const_KevesIterator pc) {
+  vm->gr1_ = vm->registers_.argument(0);
+  return enterLambda(vm, pc);
+}
+
+void KevesVM::cmd_TAIL_APPLY_LAMBDA(KevesVM* vm, const_KevesIterator pc) {
+  StackFrameKev* registers(&vm->registers_);
+  KevesFixnum num_arg(*(pc + 1));
+
+  if (num_arg >= registers->argp()->size()) registers->extendArgFrame(&vm->gc_);
+
+  registers->moveLastArguments(num_arg, 1);
+  vm->gr1_ = *pc;
+  registers->replaceFirstArgument(vm->gr1_);
+  return enterLambda(vm, pc + 2);
+}
+
+void KevesVM::enterLambda(KevesVM* vm, const_KevesIterator pc) {
+  const LambdaKev* lambda(vm->gr1_);
+  const_KevesIterator entry(lambda->proc());
+
+  Q_ASSERT(KevesInstruct(*entry) == CMD_CALL_LAMBDA);
+  Q_ASSERT(vm->registers_.argn() == KevesFixnum(*(entry + 1)) + 1);
+
+  KEVES_TRACE_EVENT(vm, call(vm->gr1_, pc));
+  if (vm->timeline_) vm->timeline_->call(vm->gr1_, vm->registers_.fp()->pc());
+
+  vm->valn_ = 0;
+  vm->beginLambda(lambda);
+  vm->registers_.makeEnvFrameWithArguments(&vm->gc_);
+  return cmd_CALL_LAMBDA_helper(vm, entry + 1);
+}
+
 void KevesVM::cmd_RETURN(KevesVM* vm, const_KevesIterator) {
-  return pushAccToArgumentSafe(vm, vm->registers_.unwind());
+  return pushAccToArgumentSafe(vm, vm->unwindFrame());
 }
 
 void KevesVM::cmd_RETURN_CONSTANT(KevesVM* vm, const_KevesIterator pc) {
   vm->acc_ = *pc;
-  return pushAccToArgumentSafe(vm, vm->registers_.unwind());
+  return pushAccToArgumentSafe(vm, vm->unwindFrame());
 }
 
 void KevesVM::cmd_RETURN0(KevesVM* vm, const_KevesIterator) {
   StackFrameKev* registers(&vm->registers_);
   vm->acc_ = registers->lastArgument();
-  return pushAccToArgumentSafe(vm, registers->unwind());
+  return pushAccToArgumentSafe(vm, vm->unwindFrame());
 }
 
 void KevesVM::cmd_RETURN_VOID(KevesVM* vm, const_KevesIterator) {
-  return cmd_NOP(vm, vm->registers_.unwind());
+  return cmd_NOP(vm, vm->unwindFrame());
 }
 
 void KevesVM::cmd_REFER_LOCAL(KevesVM* vm, const_KevesIterator pc) {
@@ -790,34 +1220,34 @@ void KevesVM::cmd_CONSTANT(KevesVM* vm, const_KevesIterator pc) {
 void KevesVM::cmd_ASSIGN_LOCAL(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev* registers(&vm->registers_);
   registers->assignLastLocalVar(vm->acc_, KevesFixnum(*pc));
-  vm->keves_vals_ = nullptr;
+  vm->valn_ = 0;
   return cmd_NOP(vm, pc + 1);
 }
 
 void KevesVM::cmd_ASSIGN_LOCAL0(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev* registers(&vm->registers_);
   registers->assignLastLocalVar(registers->lastArgument(), KevesFixnum(*pc));
-  vm->keves_vals_ = nullptr;
+  vm->valn_ = 0;
   return cmd_NOP(vm, pc + 1);
 }
 
 void KevesVM::cmd_ASSIGN_FREE(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev* registers(&vm->registers_);
   registers->assignFreeVar(KevesFixnum(*pc), vm->acc_);
-  vm->keves_vals_ = nullptr;
+  vm->valn_ = 0;
   return cmd_NOP(vm, pc + 1);
 }
 
 void KevesVM::cmd_ASSIGN_FREE0(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev* registers(&vm->registers_);
   registers->assignFreeVar(KevesFixnum(*pc), registers->lastArgument());
-  vm->keves_vals_ = nullptr;
+  vm->valn_ = 0;
   return cmd_NOP(vm, pc + 1);
 }
 
 void KevesVM::cmd_ASSIGN_MULT(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev* registers(&vm->registers_);
-  KevesFixnum idx(vm->keves_vals_->at(0));
+  int idx(vm->valn_ > 0 ? vm->valn_ : 1);
   KevesValue list_obj(*pc);
   KevesValue temp;
 
@@ -825,10 +1255,10 @@ void KevesVM::cmd_ASSIGN_MULT(KevesVM* vm, const_KevesIterator pc) {
     const PairKev* pair(list_obj);
     temp = pair->car();
     list_obj = pair->cdr();
-    registers->assignLastLocalVar(vm->keves_vals_->at(--idx), KevesFixnum(temp));
+    registers->assignLastLocalVar(vm->valueAt(--idx), KevesFixnum(temp));
   }
 
-  vm->keves_vals_ = nullptr;
+  vm->valn_ = 0;
   registers->replaceLastArgument(EMB_UNDEF);
   return cmd_NOP(vm, pc + 1);
 }
@@ -840,7 +1270,7 @@ void KevesVM::cmd_CLOSE_R(KevesVM* vm, const_KevesIterator pc) {
   const_KevesIterator body(pc + 2);
   LambdaKev lambda(closure, vm->gc_.toMutable(vm->current_code_), body);
   
-  vm->keves_vals_ = nullptr;
+  vm->valn_ = 0;
   KevesFixnum offset(*pc);
   vm->gr1_ = &lambda;
   return pushGr1ToArgumentSafe(vm, pc + offset + 3);
@@ -894,12 +1324,12 @@ void KevesVM::cmd_RAISE(KevesVM* vm, const_KevesIterator pc) {
 
   if (StackFrameKev::isBottom(registers)) {
     pc = vm->common_->builtin()->code_HALT();
-    std::cout << "cmd_RAISE: raise!!!!!!!!!!!!!" << std::endl; 
+    KEVES_LOG(KEVES_LOG_DEBUG) << "cmd_RAISE: not caught";
     vm->gr1_ = vm->acc_;
     return pushGr1ToArgumentSafe(vm, pc);
   }
   
-  std::cout << "cmd_RAISE: catch exception!!!!!!!!!!!!!" << std::endl; 
+  KEVES_LOG(KEVES_LOG_DEBUG) << "cmd_RAISE: caught";
   pc = registers->pc();
   return cmd_NOP(vm, pc);
 }
@@ -911,18 +1341,18 @@ void KevesVM::cmd_RAISE_CONSTANT(KevesVM* vm, const_KevesIterator pc) {
 
   if (StackFrameKev::isBottom(registers)) {
     pc = vm->common_->builtin()->code_HALT();
-    std::cout << "cmd_RAISE_CONSTANT: raise!!!!!!!!!!!!!" << std::endl; 
+    KEVES_LOG(KEVES_LOG_DEBUG) << "cmd_RAISE_CONSTANT: not caught";
     vm->gr1_ = condition;
     return pushGr1ToArgumentSafe(vm, pc);
   }
   
-  std::cout << "cmd_RAISE_CONSTANT: catch exception!!!!!!!!!!!!!" << std::endl; 
+  KEVES_LOG(KEVES_LOG_DEBUG) << "cmd_RAISE_CONSTANT: caught";
   pc = registers->pc();
   return cmd_NOP(vm, pc);
 }
 
 void KevesVM::cmd_CLEAR_VALS(KevesVM* vm, const_KevesIterator pc) {
-  vm->keves_vals_ = nullptr;
+  vm->valn_ = 0;
   return cmd_NOP(vm, pc);
 }
 
@@ -935,24 +1365,23 @@ void KevesVM::cmd_DEBUG_CODE(KevesVM* vm, const_KevesIterator pc) {
     temp1 = vm->common_->toString(vm->acc_);
       /*
     } catch (int i) {
-      std::cerr << "KevesVM::cmd_DEBUG_CODE(): Allocation is failed!\n";
+      KEVES_LOG(KEVES_LOG_ERROR) << "KevesVM::cmd_DEBUG_CODE(): Allocation is failed!";
     }
     try {
       */
     if (registers->argn() > 0) temp2 = vm->common_->toString(registers->lastArgument());
       /*
     } catch (int i) {
-      std::cerr << "KevesVM::cmd_DEBUG_CODE(): Allocation is failed!\n";
+      KEVES_LOG(KEVES_LOG_ERROR) << "KevesVM::cmd_DEBUG_CODE(): Allocation is failed!";
     }
       */
     if (pc->isInstruct()) {
-      std::cout << "debug: "
-		<< qPrintable(vm->common_->instruct_table()->getLabel(KevesInstruct(*pc)))
-		<< std::endl;
-      std::cout << "acc: " << qPrintable(temp1) << std::endl;
-      std::cout << "last argument: " << qPrintable(temp2) << std::endl;
+      KEVES_LOG(KEVES_LOG_DEBUG) << "debug: "
+				 << qPrintable(vm->common_->instruct_table()->getLabel(KevesInstruct(*pc)));
+      KEVES_LOG(KEVES_LOG_DEBUG) << "acc: " << qPrintable(temp1);
+      KEVES_LOG(KEVES_LOG_DEBUG) << "last argument: " << qPrintable(temp2);
     } else {
-      std::cout << "debug: " << pc->toPtr() << std::endl;
+      KEVES_LOG(KEVES_LOG_DEBUG) << "debug: " << pc->toPtr();
     }
   }
 
@@ -977,7 +1406,7 @@ void KevesVM::cmd_PUSH(KevesVM* vm, const_KevesIterator pc) {
 }
 
 void KevesVM::cmd_PUSH_CONSTANT(KevesVM* vm, const_KevesIterator pc) {
-  vm->keves_vals_ = nullptr;
+  vm->valn_ = 0;
   vm->gr1_ = *pc;
   return pushGr1ToArgument(vm, pc + 1);
 }
@@ -1060,12 +1489,12 @@ void KevesVM::cmd_TEST_NUMBER_EQUAL_R(KevesVM* vm, const_KevesIterator pc) {
   }
 
   if (arg0.is<FlonumKev>()) {
-    const FlonumKev* ir_arg0(arg0);
+    const FlonumKev ir_arg0(FlonumKev::fromKevesValue(arg0));
 
     if (vm->acc_.is<FlonumKev>()) {
-      const FlonumKev* ir_acc(vm->acc_);
+      const FlonumKev ir_acc(FlonumKev::fromKevesValue(vm->acc_));
 
-      return ir_arg0->isEqualTo(*ir_acc) ?
+      return ir_arg0.isEqualTo(ir_acc) ?
 	cmd_SKIP(vm, pc) : cmd_NOP(vm, pc + KevesFixnum(*pc) + 1);
     }
     
@@ -1093,6 +1522,158 @@ void KevesVM::cmd_TEST_NUMBER_EQUAL_R(KevesVM* vm, const_KevesIterator pc) {
   return cmd_NOP(vm, pc + KevesFixnum(*pc) + 1);
 }
 
+// The fast path handles two fixnums in the last two arguments and
+// leaves the result as if the generic procedure had been applied.
+// The operand is the generic procedure for the other cases.
+void KevesVM::cmd_ADD_FX(KevesVM* vm, const_KevesIterator pc) {
+  return calculateFixnums<&addFixnums>(vm, pc);
+}
+
+void KevesVM::cmd_SUB_FX(KevesVM* vm, const_KevesIterator pc) {
+  return calculateFixnums<&subtractFixnums>(vm, pc);
+}
+
+// LT_FX_R and NUM_EQ_FX_R must be followed by LAST_POP_TEST_R.
+// The fast path branches with its offset directly, and the generic
+// procedure returns to it.
+void KevesVM::cmd_LT_FX_R(KevesVM* vm, const_KevesIterator pc) {
+  return compareFixnums_R<&lessThanFixnums>(vm, pc);
+}
+
+void KevesVM::cmd_NUM_EQ_FX_R(KevesVM* vm, const_KevesIterator pc) {
+  return compareFixnums_R<&equalFixnums>(vm, pc);
+}
+
+// The *_FX_LOCAL instructions take the first operand from the local
+// variable indexed by the first word and the second operand from the
+// second word, instead of two pushed arguments. The third word is the
+// generic procedure. LT_FX_LOCAL_R and NUM_EQ_FX_LOCAL_R must be followed
+// by LAST_POP_TEST_R as LT_FX_R is.
+void KevesVM::cmd_ADD_FX_LOCAL(KevesVM* vm, const_KevesIterator pc) {
+  return calculateFixnumsOfLocal<&addFixnums>(vm, pc);
+}
+
+void KevesVM::cmd_SUB_FX_LOCAL(KevesVM* vm, const_KevesIterator pc) {
+  return calculateFixnumsOfLocal<&subtractFixnums>(vm, pc);
+}
+
+void KevesVM::cmd_LT_FX_LOCAL_R(KevesVM* vm, const_KevesIterator pc) {
+  return compareFixnumsOfLocal_R<&lessThanFixnums>(vm, pc);
+}
+
+void KevesVM::cmd_NUM_EQ_FX_LOCAL_R(KevesVM* vm, const_KevesIterator pc) {
+  return compareFixnumsOfLocal_R<&equalFixnums>(vm, pc);
+}
+
+// The operations below are shared by the *_FX and *_FX_LOCAL
+// instructions. addFixnums and subtractFixnums fail unless both operands
+// and the result are fixnums; the tests expect two fixnums.
+bool KevesVM::addFixnums(KevesValue augend, KevesValue addend,
+			 KevesValue* sum) {
+  if (!augend.isFixnum() || !addend.isFixnum()) return false;
+
+  fx_int result(KevesFixnum(augend) + KevesFixnum(addend));
+  if (!KevesFixnum::isInRange(result)) return false;
+
+  *sum = KevesFixnum(result);
+  return true;
+}
+
+bool KevesVM::subtractFixnums(KevesValue minuend, KevesValue subtrahend,
+			      KevesValue* difference) {
+  if (!minuend.isFixnum() || !subtrahend.isFixnum()) return false;
+
+  fx_int result(KevesFixnum(minuend) - KevesFixnum(subtrahend));
+  if (!KevesFixnum::isInRange(result)) return false;
+
+  *difference = KevesFixnum(result);
+  return true;
+}
+
+bool KevesVM::lessThanFixnums(KevesValue lhs, KevesValue rhs) {
+  return KevesFixnum(lhs) < KevesFixnum(rhs);
+}
+
+bool KevesVM::equalFixnums(KevesValue lhs, KevesValue rhs) {
+  return lhs == rhs;
+}
+
+template<bool (*OPERATE)(KevesValue, KevesValue, KevesValue*)>
+void KevesVM::calculateFixnums(KevesVM* vm, const_KevesIterator pc) {
+  StackFrameKev* registers(&vm->registers_);
+  KevesValue result;
+
+  if (OPERATE(registers->lastArgument(1), registers->lastArgument(), &result)) {
+    vm->acc_ = result;
+    registers->popArgument();
+    registers->replaceLastArgument(vm->acc_);
+    return cmd_NOP(vm, pc + 1);
+  }
+
+  return applyBinaryProcedure(vm, pc);
+}
+
+template<bool (*OPERATE)(KevesValue, KevesValue, KevesValue*)>
+void KevesVM::calculateFixnumsOfLocal(KevesVM* vm, const_KevesIterator pc) {
+  KevesValue lhs(vm->registers_.lastLocalVar(KevesFixnum(*pc)));
+  KevesValue rhs(*(pc + 1));
+  KevesValue result;
+
+  if (OPERATE(lhs, rhs, &result)) {
+    vm->acc_ = result;
+    vm->gr1_ = vm->acc_;
+    return pushGr1ToArgument(vm, pc + 3);
+  }
+
+  vm->gr1_ = lhs;
+  vm->gr2_ = rhs;
+  return applyBinaryProcedureToRegisters(vm, pc + 2);
+}
+
+template<bool (*TEST)(KevesValue, KevesValue)>
+void KevesVM::compareFixnums_R(KevesVM* vm, const_KevesIterator pc) {
+  StackFrameKev* registers(&vm->registers_);
+  KevesValue lhs(registers->lastArgument(1));
+  KevesValue rhs(registers->lastArgument());
+
+  Q_ASSERT(KevesInstruct(*(pc + 1)) == CMD_LAST_POP_TEST_R);
+
+  if (lhs.isFixnum() && rhs.isFixnum()) {
+    registers->popArgument();
+    registers->popArgument();
+    return branchByFixnumTest(vm, TEST(lhs, rhs), pc + 2);
+  }
+
+  return applyBinaryProcedure(vm, pc);
+}
+
+template<bool (*TEST)(KevesValue, KevesValue)>
+void KevesVM::compareFixnumsOfLocal_R(KevesVM* vm, const_KevesIterator pc) {
+  KevesValue lhs(vm->registers_.lastLocalVar(KevesFixnum(*pc)));
+  KevesValue rhs(*(pc + 1));
+
+  Q_ASSERT(KevesInstruct(*(pc + 3)) == CMD_LAST_POP_TEST_R);
+
+  if (lhs.isFixnum() && rhs.isFixnum())
+    return branchByFixnumTest(vm, TEST(lhs, rhs), pc + 4);
+
+  vm->gr1_ = lhs;
+  vm->gr2_ = rhs;
+  return applyBinaryProcedureToRegisters(vm, pc + 2);
+}
+
+// pc points to the offset of the LAST_POP_TEST_R which follows a test.
+void KevesVM::branchByFixnumTest(KevesVM* vm, bool result,
+				 const_KevesIterator pc) {
+  if (result) {
+    vm->acc_ = EMB_TRUE;
+    return cmd_NOP(vm, pc + 1);
+  }
+
+  vm->acc_ = EMB_FALSE;
+  return cmd_NOP(vm, pc + KevesFixnum(*pc) + 1);
+}
+
 void KevesVM::cmd_TEST_CHAR_R(KevesVM* vm, const_KevesIterator pc) {
   return vm->acc_.isChar() ?
     cmd_SKIP(vm, pc) : cmd_NOP(vm, pc + KevesFixnum(*pc) + 1);
@@ -1280,6 +1861,7 @@ void KevesVM::cmd_BEGIN(KevesVM* vm, const_KevesIterator pc) {
 
   StackFrameKev stack_frame;
   registers->wind(pc, &stack_frame, &arg_frame);
+  if (vm->timeline_) vm->timeline_->begin("evaluate", pc);
 
   registers->pushArgument(vm->acc_); // push procedure
   registers->pushArgument(vm->gr1_); // push code
@@ -1317,7 +1899,7 @@ void KevesVM::cmd_SYNTAX(KevesVM* vm, const_KevesIterator pc) {
 		       EMB_NULL,
 		       vm->curt_global_vars_.values());
 
-    vm->keves_vals_ = nullptr;
+    vm->valn_ = 0;
     vm->gr1_ = &wrapped;
     return pushGr1ToArgumentSafe(vm, pc + 1);
   }
@@ -1326,6 +1908,7 @@ void KevesVM::cmd_SYNTAX(KevesVM* vm, const_KevesIterator pc) {
 }
 
 void KevesVM::cmd_TERMINATE_EXPAND(KevesVM* vm, const_KevesIterator pc) {
+  double begin(vm->timeline_ ? vm->timeline_->now() : 0.0);
   const VectorKev* expanded(vm->acc_);
   int size(expanded->size());
   int cnt(0);
@@ -1357,6 +1940,7 @@ void KevesVM::cmd_TERMINATE_EXPAND(KevesVM* vm, const_KevesIterator pc) {
   LambdaKev proc(code, 0);
   vm->acc_ = &proc;
   vm->gr1_ = code;
+  if (vm->timeline_) vm->timeline_->addSpan("TERMINATE_EXPAND", "vm", begin);
   // vm->executeGC(&cmd_NOP, pc);
   return cmd_NOP(vm, pc);
 }
@@ -1390,40 +1974,22 @@ void KevesVM::cmd_TEST_ENVIRONMENT(KevesVM* vm, const_KevesIterator pc) {
 
 // make &lexical exception
 void KevesVM::makeLexicalException(KevesVM* vm, const_KevesIterator pc) {
-  VectorKevWithArray<04> values(4);
-
-  vm->checkStack(&values, &makeLexicalException, pc);
-
-  SimpleConditionKev violation(vm->common_->builtin()->amp_lexical(), EMB_NULL);
-  SimpleConditionKev who(vm->common_->builtin()->amp_who(), vm->acc_);
-  SimpleConditionKev message(vm->common_->builtin()->amp_message(), vm->gr1_);
-  SimpleConditionKev irritants(vm->common_->builtin()->amp_irritants(), vm->gr2_);
-  CompoundConditionKev condition(&values);
-  KevesIterator iter(values.begin());
-  *iter++ = &violation;
-  *iter++ = &who;
-  *iter++ = &message;
-  *iter++ = &irritants;
+  AssertConditionKev condition(vm->common_->builtin()->amp_lexical(),
+			       vm->acc_, vm->gr1_, vm->gr2_);
+
+  vm->checkStack(&condition, &makeLexicalException, pc);
+
   vm->acc_ = &condition;
   return cmd_NOP(vm, pc);
 }
 
 // raise &assert
 void KevesVM::raiseAssertCondition(KevesVM* vm, const_KevesIterator pc) {
-  VectorKevWithArray<04> values(4);
-
-  vm->checkStack(&values, &raiseAssertCondition, pc);
-
-  SimpleConditionKev violation(vm->common_->builtin()->amp_lexical(), EMB_NULL);
-  SimpleConditionKev who(vm->common_->builtin()->amp_who(), vm->acc_);
-  SimpleConditionKev message(vm->common_->builtin()->amp_message(), vm->gr1_);
-  SimpleConditionKev irritants(vm->common_->builtin()->amp_irritants(), vm->gr2_);
-  CompoundConditionKev condition(&values);
-  KevesIterator iter(values.begin());
-  *iter++ = &violation;
-  *iter++ = &who;
-  *iter++ = &message;
-  *iter++ = &irritants;
+  AssertConditionKev condition(vm->common_->builtin()->amp_lexical(),
+			       vm->acc_, vm->gr1_, vm->gr2_);
+
+  vm->checkStack(&condition, &raiseAssertCondition, pc);
+
   vm->acc_ = &condition;
   return cmd_RAISE(vm, pc);
 }
@@ -1457,12 +2023,38 @@ KevesValue KevesVM::findConditionValue(KevesValue condition, RecordKev* type) {
       const CompoundConditionKev* compound(condition);
       const VectorKev* contentStack(compound->values());
       for (KevesValue elem : *contentStack) stack.push(elem);
+
+    } else if (condition.is<AssertConditionKev>()) {
+      KevesValue value(findAssertConditionValue(condition, type));
+
+      if (value != EMB_UNDEF)
+	return value;
     }
   }
 
   return EMB_UNDEF;
 }
 
+// expand the fields of an assertion condition only when one is looked up
+KevesValue KevesVM::findAssertConditionValue(const AssertConditionKev* condition,
+					     const RecordKev* type) {
+  KevesBuiltinValues* builtin(common_->builtin());
+
+  if (type == condition->kind())
+    return EMB_NULL;
+
+  if (type == builtin->amp_who())
+    return condition->who();
+
+  if (type == builtin->amp_message())
+    return condition->message();
+
+  if (type == builtin->amp_irritants())
+    return condition->irritants();
+
+  return EMB_UNDEF;
+}
+
 
 void KevesVM::cmd_UNWIND_CONTINUATION(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev* registers(&vm->registers_);
@@ -1476,86 +2068,161 @@ void KevesVM::cmd_UNWIND_CONTINUATION(KevesVM* vm, const_KevesIterator pc) {
   vm->keves_vals_ = registers->argp();
   vm->keves_vals_->assign(0, KevesFixnum(registers->argn()));
 
-  // trace back to current-continuation
-  // if WindKev object is found, set <after> of it and *this*
-  // into <begin> sequence and return. 
-  const StackFrameKev* fp(registers->fp());
-  KevesValue first_obj(fp->argn() > 0 ? fp->argument(0) : EMB_NULL);
-
-  for (;;) {
-    if (StackFrameKev::isBottom(fp)) {
-      pc = registers->unwind();
-      vm->gc_.toMutable(conti_obj->btmp())->set_pc(pc);
-      *registers = conti_obj->registers();
-      pc = vm->common_->builtin()->code_REVERT_DYNAMIC_WIND_and_APPLY();
-      vm->acc_ = conti_obj;
-      vm->gr1_ = vm->keves_vals_->at(1);
-
-      return pushGr1ToArgument(vm, pc); // return value
-    }
+  // Escapes which are not shared with the continuation are left.
+  KevesValue escapes(registers->escapes());
+  KevesValue target_escapes(conti_obj->registers().escapes());
+  vm->expireEscapes(escapes, EscapeKev::commonAncestor(escapes, target_escapes));
 
-    if (fp->argp() == conti_obj->registers().argp()) {
-      pc = registers->unwind();
-      *registers = conti_obj->registers();
-      vm->gr1_ = vm->keves_vals_->at(1);
-      return pushGr1ToArgument(vm, pc); // return value
-    }
-    
-    pc = registers->unwind();
-
-    if (first_obj.is<WindKev>()) {
-      pc = registers->unwind();
-      StackFrameKev stack_frame1;
-      registers->windWithValues(pc, &stack_frame1, vm->keves_vals_);
-      pc = vm->common_->builtin()->code_POP_APPLY();
-      registers->replaceFirstArgument(conti_obj);
-
-      StackFrameKev stack_frame2;
-      registers->wind(pc, &stack_frame2, &arg_frame);
-      const WindKev* wind(first_obj);
-      registers->pushArgument(wind->after());
-      return cmd_APPLY(vm, pc);
-    }
+  // Only winds which are not shared with the continuation are passed.
+  // <after> of the innermost one or <before> of the outermost one is
+  // applied, and then *this* is applied again.
+  KevesValue winders(registers->winders());
+  KevesValue target(conti_obj->registers().winders());
+  KevesValue common(WindKev::commonAncestor(winders, target));
+
+  if (winders != common)
+    return leaveDynamicWind(vm, pc, conti_obj, &cmd_UNWIND_CONTINUATION);
+
+  if (winders != target)
+    return enterDynamicWind(vm, pc, conti_obj, &cmd_UNWIND_CONTINUATION);
+
+  // if the continuation was captured under another bottom frame,
+  // it returns to the current one
+  const StackFrameKev* btmp(registers->sfp());
+  while (!StackFrameKev::isBottom(btmp)) btmp = btmp->sfp();
+
+  if (btmp != conti_obj->btmp())
+    vm->gc_.toMutable(conti_obj->btmp())->set_pc(btmp->pc());
 
-    fp = registers->fp();
-    first_obj = fp->argn() > 0 ? fp->argument(0) : EMB_NULL;
+  *registers = conti_obj->registers();
+  pc = registers->pc();
+  vm->takeUnwoundValues();
+  return pushGr1ToArgument(vm, pc); // return value
+}
+
+// keep the values passed to a continuation, and set the first one,
+// or the unspecified value when no value was passed, to gr1_
+void KevesVM::takeUnwoundValues() {
+  int argn(KevesFixnum(keves_vals_->at(0)));
+
+  if (argn > 1) {
+    keepValues(keves_vals_, argn);
+    gr1_ = keves_vals_->at(1);
+    return;
   }
+
+  valn_ = 0;
+  gr1_ = EMB_UNDEF;
 }
 
-void KevesVM::cmd_REVERT_DYNAMIC_WIND(KevesVM* vm, const_KevesIterator pc) {
-  const ContinuationKev* conti_obj(vm->acc_);
-  StackFrameKev frame(conti_obj->registers());
-  vm->gr1_ = KevesValue(&frame);
-  return revertDynamicWind(vm, pc);
+// apply <after> of the innermost wind in the frame which called
+// dynamic-wind, and then apply *conti* with the kept values.
+// *retry* is the caller, which is executed again after GC.
+void KevesVM::leaveDynamicWind(KevesVM* vm, const_KevesIterator pc,
+			       KevesValue conti, vm_func retry) {
+  StackFrameKev* registers(&vm->registers_);
+  ArgumentFrameKevWithArray<04> arg_frame;
+
+  vm->checkStack(&arg_frame, retry, pc);
+
+  const WindKev* wind(registers->winders());
+
+  registers->set_fp(vm->gc_.toMutable(wind->fp()));
+  pc = vm->unwindFrame();
+  StackFrameKev stack_frame1;
+  registers->windWithValues(pc, &stack_frame1, vm->keves_vals_);
+  pc = vm->common_->builtin()->code_POP_APPLY();
+  registers->replaceFirstArgument(conti);
+
+  StackFrameKev stack_frame2;
+  registers->wind(pc, &stack_frame2, &arg_frame);
+  registers->pushArgument(wind->after());
+  return cmd_APPLY(vm, pc);
 }
 
-void KevesVM::revertDynamicWind(KevesVM* vm, const_KevesIterator pc) {
+// apply <before> of the outermost wind which the continuation is in but
+// the current frame is not, and then apply *conti* in its extent.
+// *retry* is the caller, which is executed again after GC.
+void KevesVM::enterDynamicWind(KevesVM* vm, const_KevesIterator pc,
+			       const ContinuationKev* conti, vm_func retry) {
   StackFrameKev* registers(&vm->registers_);
   ArgumentFrameKevWithArray<04> arg_frame;
 
-  vm->checkStack(&arg_frame, &revertDynamicWind, pc);
+  vm->checkStack(&arg_frame, retry, pc);
 
-  const ContinuationKev* conti_obj(vm->acc_);
-  const StackFrameKev* temp_fp(vm->gr1_);
+  KevesValue winders(registers->winders());
+  const WindKev* wind(conti->registers().winders());
 
-  if (temp_fp->fp() == conti_obj->btmp())
-    return cmd_NOP(vm, pc);
-  
-  StackFrameKev stack_frame;
-  temp_fp = temp_fp->fp();
-  KevesValue first_obj(temp_fp->argn() > 0 ?
-		       temp_fp->argument(0) : KevesValue(EMB_NULL));
-  
-  if (first_obj.is<WindKev>()) {
-    const WindKev* wind(first_obj);
-    pc = vm->common_->builtin()->code_POP_APPLY();
-    registers->wind(pc, &stack_frame, &arg_frame);
-    pc = vm->common_->builtin()->code_APPLY();
-    registers->pushArgument(wind->before());
+  while (wind->outer() != winders) wind = wind->outer();
+
+  StackFrameKev stack_frame1;
+  registers->windWithValues(pc, &stack_frame1, vm->keves_vals_);
+  pc = vm->common_->builtin()->code_POP_APPLY();
+  registers->replaceFirstArgument(conti);
+  registers->set_winders(wind);
+
+  StackFrameKev stack_frame2;
+  registers->wind(pc, &stack_frame2, &arg_frame);
+  registers->set_winders(winders);
+  registers->pushArgument(wind->before());
+  return cmd_APPLY(vm, pc);
+}
+
+// The escape returns to its frame directly unless a dynamic wind was
+// entered after call/ec. In that case, <after> of the innermost one is
+// applied first, and then the escape is applied again.
+// The escape is valid only while its frame is in the current chain of
+// frames. Control leaves the frame by a return, another escape or a
+// continuation, each of which expires the escapes left, so an escape
+// which is not expired is always in registers_.escapes().
+void KevesVM::unwindEscape(KevesVM* vm, const_KevesIterator pc) {
+  StackFrameKev* registers(&vm->registers_);
+  ArgumentFrameKevWithArray<04> arg_frame;
+
+  vm->checkStack(&arg_frame, &unwindEscape, pc);
+
+  const EscapeKev* escape(vm->gr1_);
+
+  if (escape->isExpired())
+    return raiseAssertEscapeExpired(vm, pc);
+
+  // the escapes taken in the extent of this one are left
+  vm->expireEscapes(registers->escapes(), escape);
+
+  // keep arguments as multiple values
+  vm->keves_vals_ = registers->argp();
+  vm->keves_vals_->assign(0, KevesFixnum(registers->argn()));
+
+  if (registers->winders() != escape->fp()->winders())
+    return leaveDynamicWind(vm, pc, escape, &unwindEscape);
+
+  registers->set_fp(vm->gc_.toMutable(escape->fp()));
+  vm->gc_.toMutable(escape)->expire();
+  pc = vm->unwindFrame();
+  vm->takeUnwoundValues();
+  return pushGr1ToArgument(vm, pc); // return value
+}
+
+// expire the escapes in the list from *escapes* until *end*, which is
+// one of them or an ancestor of them. Each escape is expired once.
+void KevesVM::expireEscapes(KevesValue escapes, KevesValue end) {
+  int depth(EscapeKev::depth(end));
+
+  while (EscapeKev::depth(escapes) > depth) {
+    const EscapeKev* escape(escapes);
+    gc_.toMutable(escape)->expire();
+    escapes = escape->outer();
   }
-  
-  vm->gr1_ = KevesValue(temp_fp);
-  return revertDynamicWind(vm, pc);
+
+  Q_ASSERT(escapes == end);
+}
+
+void KevesVM::cmd_EXPIRE_ESCAPE(KevesVM* vm, const_KevesIterator) {
+  StackFrameKev* registers(&vm->registers_);
+  const EscapeKev* escape(registers->argument(0));
+  vm->gc_.toMutable(escape)->expire();
+  vm->acc_ = registers->lastArgument();
+  return pushAccToArgumentSafe(vm, vm->unwindFrame());
 }
 
 void KevesVM::cmd_SET_DYNAMIC_WIND(KevesVM* vm, const_KevesIterator pc) {
@@ -1574,8 +2241,9 @@ void KevesVM::cmd_SET_DYNAMIC_WIND(KevesVM* vm, const_KevesIterator pc) {
   registers->wind(pc, &stack_frame1, &arg_frame1);
   pc = vm->common_->builtin()->code_REMOVE_DYNAMIC_WIND();
 
-  WindKev wind(before, thunk, after);
+  WindKev wind(before, thunk, after, registers->winders(), &stack_frame1);
   registers->pushArgument(&wind);
+  registers->set_winders(&wind);
 
   // wind
   StackFrameKev stack_frame2;
@@ -1591,7 +2259,7 @@ void KevesVM::cmd_REMOVE_DYNAMIC_WIND(KevesVM* vm, const_KevesIterator pc) {
   vm->checkStack(&stack_frame, &cmd_REMOVE_DYNAMIC_WIND, pc);
   const WindKev* first_obj(registers->argument(0));
   KevesValue result_of_thunk(registers->lastArgument());
-  pc = registers->unwind();
+  pc = vm->unwindFrame();
 
   registers->replaceLastArgument(result_of_thunk);
   pc = vm->common_->builtin()->code_POP_RETURN();
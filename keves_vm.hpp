@@ -19,24 +19,46 @@
 
 #pragma once
 
+#include <csignal>
 #include <setjmp.h>
 #include <QChar>
 #include <QRunnable>
+#include <QStringList>
 #include "keves_gc.hpp"
 #include "keves_gc-inl.hpp"
 #include "keves_value.hpp"
 #include "kev/environment.hpp"
 #include "kev/frame.hpp"
 
+class AssertConditionKev;
 class CodeKev;
+class ContinuationKev;
 class ExactComplexNumberKev;
 class KevesCommon;
+class KevesAllocProfile;
+class KevesCallProfile;
+class KevesCodeCounters;
+class KevesPerfCounters;
+class KevesProfile;
+class KevesSampler;
 class KevesTextualOutputPort;
+class KevesTimeline;
+class KevesTrace;
+class KevesVMTimeline;
 class RationalNumberKev;
 class RecordKev;
 class StringKev;
 class VectorKev;
 
+// Events are recorded in the trace of a VM only if KEVES_TRACE is defined,
+// which must not change the layout of KevesVM shared with plugins.
+#ifdef KEVES_TRACE
+#define KEVES_TRACE_EVENT(vm, event) \
+  do { if ((vm)->trace_) (vm)->trace_->event; } while (0)
+#else
+#define KEVES_TRACE_EVENT(vm, event) do {} while (0)
+#endif
+
 class KevesVM : public QRunnable {
 public:
   KevesVM() = default;
@@ -44,7 +66,7 @@ public:
   KevesVM(const KevesVM&&) = delete;
   KevesVM& operator=(const KevesVM&) = delete;
   KevesVM& operator=(const KevesVM&&) = delete;
-  ~KevesVM() = default;
+  ~KevesVM();
 
   ////////////////////////////////////////////////////////////////
   // General                                                    //
@@ -68,6 +90,17 @@ public:
 
   static KevesVM* make(KevesCommon* common,
 		       KevesTextualOutputPort* result_field);
+
+  // Run my-code and environment of the library instead of (keves base).
+  void set_main_library(const QStringList& id) {
+    main_library_ = id;
+  }
+
+  // Limit the room of eden on the stack to size bytes, which is not
+  // less than the margin left for GC. 0 uses all the stack.
+  void set_nursery_size(size_t size) {
+    nursery_size_ = size;
+  }
   
 private:
   int execute();
@@ -89,10 +122,19 @@ public:
   static void returnValueSafe(KevesVM*, const_KevesIterator);
   static void returnValue(KevesVM*, const_KevesIterator);
   static void returnTwoValues(KevesVM*, const_KevesIterator);
+  void keepValues(ArgumentFrameKev* frame, int argn);
+  KevesValue valueAt(int index) const;
+
+  const_KevesIterator unwindFrame() {
+    if (call_profile_) leaveCalls();
+    if (timeline_) return unwindFrameOnTimeline();
+    return registers_.unwind();
+  }
 
   // Make and Raise Exceptions
   static void makeLexicalException(KevesVM*, const_KevesIterator);
   static void raiseAssertFirstObjNotProc(KevesVM*, const_KevesIterator);
+  static void raiseAssertEscapeExpired(KevesVM*, const_KevesIterator);
   static void raiseAssertLambdaReqLess(KevesVM*, const_KevesIterator);
   static void raiseAssertLambdaReqMore(KevesVM*, const_KevesIterator);
   static void raiseAssertReqRealNum(KevesVM*, const_KevesIterator);
@@ -123,6 +165,7 @@ public:
   // for string
   StringKev* makeString(int);
   const StringKev* makeString(int, QChar);
+  StringKev* makeString(const QString&);
 
   // for vector
   VectorKev* makeVector(int);
@@ -130,15 +173,19 @@ public:
 
   // for procedures
   static void applyProcedure(KevesVM*, const_KevesIterator);
+  static void applyBinaryProcedure(KevesVM*, const_KevesIterator);
+  static void applyBinaryProcedureToRegisters(KevesVM*, const_KevesIterator);
+  template<int SIZE> static void windArgumentFrame(KevesVM*, const_KevesIterator);
 
   // for others
   void toString(KevesValue, QString*);
   static void displayCode(KevesVM*, const_KevesIterator);
-  static void revertDynamicWind(KevesVM*, const_KevesIterator);
 
 
   static void cmd_NOP(KevesVM*, const_KevesIterator);
   static void cmd_HALT(KevesVM*, const_KevesIterator);
+  static void exitWithResult(KevesVM*, const_KevesIterator);
+  bool isInEden(KevesValue) const;
   static void cmd_JUMP(KevesVM*, const_KevesIterator);
   static void cmd_JUMP_R(KevesVM*, const_KevesIterator);
   static void cmd_SKIP(KevesVM*, const_KevesIterator);
@@ -150,10 +197,16 @@ public:
   static void cmd_SWITCH_N_ARG_R(KevesVM*, const_KevesIterator);
   static void cmd_FRAME(KevesVM*, const_KevesIterator);
   static void cmd_FRAME_R(KevesVM*, const_KevesIterator);
+  static void cmd_FRAME_N_R(KevesVM*, const_KevesIterator);
   static void cmd_SFRAME(KevesVM*, const_KevesIterator);
   static void cmd_APPLY(KevesVM*, const_KevesIterator);
   static void cmd_APPLY_CONSTANT(KevesVM*, const_KevesIterator);
   static void cmd_APPLY_MULT(KevesVM*, const_KevesIterator);
+  static void cmd_TAIL_APPLY(KevesVM*, const_KevesIterator);
+  static void cmd_TAIL_APPLY_CONSTANT(KevesVM*, const_KevesIterator);
+  static void cmd_APPLY_LAMBDA(KevesVM*, const_KevesIterator);
+  static void cmd_TAIL_APPLY_LAMBDA(KevesVM*, const_KevesIterator);
+  static void enterLambda(KevesVM*, const_KevesIterator);
   static void cmd_RETURN(KevesVM*, const_KevesIterator);
   static void cmd_RETURN_CONSTANT(KevesVM*, const_KevesIterator);
   static void cmd_RETURN0(KevesVM*, const_KevesIterator);
@@ -168,7 +221,8 @@ public:
   static void cmd_CALL_LAMBDA(KevesVM*, const_KevesIterator);
   static void cmd_CALL_LAMBDA_helper(KevesVM*, const_KevesIterator);
   static void cmd_CALL_LAMBDA_VLA(KevesVM*, const_KevesIterator);
-  static void cmd_CALL_LAMBDA_VLA_helper(KevesVM*, const_KevesIterator);
+  template<int SIZE> static void makeRestList(KevesVM*, const_KevesIterator);
+  static void makeRestListInTenured(KevesVM*, const_KevesIterator);
   static void cmd_ASSIGN_FREE(KevesVM*, const_KevesIterator);
   static void cmd_ASSIGN_FREE0(KevesVM*, const_KevesIterator);
   static void cmd_ASSIGN_MULT(KevesVM*, const_KevesIterator);
@@ -199,6 +253,29 @@ public:
 
   static void cmd_TEST_NUMBER_EQUAL_R(KevesVM*, const_KevesIterator);
 
+  // for fixnums
+  static void cmd_ADD_FX(KevesVM*, const_KevesIterator);
+  static void cmd_SUB_FX(KevesVM*, const_KevesIterator);
+  static void cmd_LT_FX_R(KevesVM*, const_KevesIterator);
+  static void cmd_NUM_EQ_FX_R(KevesVM*, const_KevesIterator);
+  static void cmd_ADD_FX_LOCAL(KevesVM*, const_KevesIterator);
+  static void cmd_SUB_FX_LOCAL(KevesVM*, const_KevesIterator);
+  static void cmd_LT_FX_LOCAL_R(KevesVM*, const_KevesIterator);
+  static void cmd_NUM_EQ_FX_LOCAL_R(KevesVM*, const_KevesIterator);
+  static bool addFixnums(KevesValue, KevesValue, KevesValue*);
+  static bool subtractFixnums(KevesValue, KevesValue, KevesValue*);
+  static bool lessThanFixnums(KevesValue, KevesValue);
+  static bool equalFixnums(KevesValue, KevesValue);
+  template<bool (*OPERATE)(KevesValue, KevesValue, KevesValue*)>
+  static void calculateFixnums(KevesVM*, const_KevesIterator);
+  template<bool (*OPERATE)(KevesValue, KevesValue, KevesValue*)>
+  static void calculateFixnumsOfLocal(KevesVM*, const_KevesIterator);
+  template<bool (*TEST)(KevesValue, KevesValue)>
+  static void compareFixnums_R(KevesVM*, const_KevesIterator);
+  template<bool (*TEST)(KevesValue, KevesValue)>
+  static void compareFixnumsOfLocal_R(KevesVM*, const_KevesIterator);
+  static void branchByFixnumTest(KevesVM*, bool, const_KevesIterator);
+
   // for char
   static void cmd_TEST_CHAR_R(KevesVM*, const_KevesIterator);
   static void cmd_TEST_CHAR0_R(KevesVM*, const_KevesIterator);
@@ -230,11 +307,16 @@ public:
 
   // for call/cc
   static void cmd_UNWIND_CONTINUATION(KevesVM*, const_KevesIterator);
-  static void cmd_REVERT_DYNAMIC_WIND(KevesVM*, const_KevesIterator);
+  static void cmd_EXPIRE_ESCAPE(KevesVM*, const_KevesIterator);
+  static void unwindEscape(KevesVM*, const_KevesIterator);
+  void expireEscapes(KevesValue, KevesValue);
+  void takeUnwoundValues();
 
   // for dynamic-wind
   static void cmd_SET_DYNAMIC_WIND(KevesVM*, const_KevesIterator);
   static void cmd_REMOVE_DYNAMIC_WIND(KevesVM*, const_KevesIterator);
+  static void leaveDynamicWind(KevesVM*, const_KevesIterator, KevesValue, vm_func);
+  static void enterDynamicWind(KevesVM*, const_KevesIterator, const ContinuationKev*, vm_func);
 
   // for vectors
   static void cmd_LIST_TO_VECTOR(KevesVM*, const_KevesIterator);
@@ -265,6 +347,7 @@ public:
   void checkStack(const void*, vm_func, const_KevesIterator);
   void executeGC(vm_func, const_KevesIterator);
   KevesValue findConditionValue(KevesValue, RecordKev*);
+  KevesValue findAssertConditionValue(const AssertConditionKev*, const RecordKev*);
 
   void* stack_lower_limit() {
     return &stack_lower_limit_;
@@ -294,11 +377,92 @@ public:
     return current_code_;
   }
 
+  ////////////////////////////////////////////////////////////////
+  // tiered execution                                           //
+  ////////////////////////////////////////////////////////////////
+public:
+  // A tier-up function is called once when the entry or back-edge
+  // counter of a code reaches its threshold. It may rewrite the code in
+  // place, keeping the positions of the entries and branch targets.
+  // Code is counted only if a threshold is set or startCodeCounters is
+  // called. Only the counters and this hook are provided: there is no
+  // optimizing tier to switch to yet, and reportHotCode only logs the
+  // code (see doc/baseline-jit.txt).
+  typedef void (*tier_up_func)(KevesVM*, CodeKev*);
+
+  void set_tier_up(tier_up_func func,
+		   quint32 entry_threshold,
+		   quint32 back_edge_threshold);
+
+  // Count entries and back edges of all code, and write them to the file
+  // as CSV at the end, unless the file name is empty.
+  void startCodeCounters(const QString& file_name);
+
+  static void reportHotCode(KevesVM*, CodeKev*);
+
+private:
+  void beginLambda(const LambdaKev* lambda);
+  void countEntry(const CodeKev* code);
+  void countBackEdge(const_KevesIterator pc);
+
+  ////////////////////////////////////////////////////////////////
+  // profile                                                    //
+  ////////////////////////////////////////////////////////////////
+public:
+  // Count instructions and pairs of them until the VM finishes, and write
+  // them to the file as JSON if its name ends with .json, otherwise as CSV.
+  void startProfile(const QString& file_name);
+
+  // Sample the running instruction and its return points by SIGPROF at hz
+  // of the CPU time of the VM thread, and write them to the file as folded
+  // stacks when the VM finishes.
+  void startSampling(const QString& file_name, int hz);
+
+  // Count calls of procedures and measure their time until the VM
+  // finishes, and write them to the file as CSV.
+  void startCallProfile(const QString& file_name);
+
+  const KevesCallProfile* call_profile() const {
+    return call_profile_;
+  }
+
+  // Total bytes allocated in tenured, directly or by promotion, by the
+  // type of objects, attribute those made directly to the running
+  // instruction, and write them to the file when the VM finishes.
+  void startAllocProfile(const QString& file_name);
+
+  // Add spans of running, top-level calls, evaluation and GC to the
+  // timeline.
+  void startTimeline(KevesTimeline* timeline);
+
+  // Count instructions, cycles, branch misses and cache misses of
+  // execute() and the phases of GC, and report them after the GC time.
+  void startPerfCounters();
+
+  // Record the last executed instructions, calls and GC in a ring buffer,
+  // which is dumped on a fatal error, on SIGUSR2 or by dumpTrace(). They do
+  // nothing unless KEVES_TRACE is defined.
+  void startTrace();
+  void dumpTrace() const;
+
+private:
+  static vm_func* instrumentedTable();
+  static void countInstruct(KevesVM*, const_KevesIterator);
+  void leaveCalls();
+  const_KevesIterator unwindFrameOnTimeline();
+
   ////////////////////////////////////////////////////////////////
   // vaules                                                     //
   ////////////////////////////////////////////////////////////////
 public:
+  // Multiple values up to VALS_SIZE are kept in vals_, and more in
+  // keves_vals_ with the number of them plus one in its slot 0.
+  // valn_ is 0 unless the last value was returned with others.
+  static constexpr int VALS_SIZE = 4;
+
   ArgumentFrameKev* keves_vals_;
+  int valn_;
+  KevesValue vals_[VALS_SIZE];
   StackFrameKev registers_;
   KevesValue acc_;
   KevesValue gr1_;
@@ -310,6 +474,7 @@ private:
   vm_func* cmd_table_;
   KevesGC gc_;
   KevesTextualOutputPort* result_field_;
+  QStringList main_library_;
 
   EnvironmentKev curt_global_vars_;
   EnvironmentKev prev_global_vars_;
@@ -319,7 +484,29 @@ private:
   void* stack_lower_limit_;
   void* stack_higher_limit_;
   void* stack_safety_limit_;
+  size_t nursery_size_ = 0;
   vm_func current_function_;
   const_KevesIterator current_pc_;
   const CodeKev* current_code_;
+
+  // for tiered execution, 0 as a threshold disables it
+  KevesCodeCounters* code_counters_ = nullptr;
+  tier_up_func tier_up_ = nullptr;
+  quint32 entry_threshold_ = 0;
+  quint32 back_edge_threshold_ = 0;
+
+  KevesProfile* profile_ = nullptr;
+
+  // for sampling, a sample requested in GC is taken after it
+  KevesSampler* sampler_ = nullptr;
+  const KevesValue* volatile running_pc_ = nullptr; // kept by countInstruct
+  bool in_gc_ = false;
+
+  KevesCallProfile* call_profile_ = nullptr;
+  KevesAllocProfile* alloc_profile_ = nullptr;
+  KevesVMTimeline* timeline_ = nullptr;
+  KevesPerfCounters* perf_counters_ = nullptr;
+
+public:
+  KevesTrace* trace_ = nullptr; // nullptr unless KEVES_TRACE is defined
 };
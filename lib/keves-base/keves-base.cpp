@@ -27,6 +27,8 @@
 #include "keves_builtin_values.hpp"
 #include "keves_common.hpp"
 #include "keves_common-inl.hpp"
+#include "keves_log.hpp"
+#include "keves_profile.hpp"
 #include "keves_template.hpp"
 #include "keves_vm.hpp"
 #include "kev/code.hpp"
@@ -41,7 +43,7 @@
 
 
 void LibKevesBase::init(KevesCommon* common) {
-  std::cout << "LibKevesBase::init()" << std::endl;
+  KEVES_LOG(KEVES_LOG_DEBUG) << "LibKevesBase::init()";
 
   // setID("keves", "base-bin");
   // setVerNum(0, 1);
@@ -49,14 +51,17 @@ void LibKevesBase::init(KevesCommon* common) {
   sym_display_ = SymbolKev::make(common, "display");
   sym_newline_ = SymbolKev::make(common, "newline");
   sym_u8_list_to_vector_ = SymbolKev::make(common, "u8-list->vector");
+  sym_call_profile_ = SymbolKev::make(common, "call-profile");
 
   proc_display_.set(procDisplay, sym_display_);
   proc_newline_.set(&Function::thunk<Newline>, sym_newline_);
   proc_u8_list_to_vector_.set(&procU8ListToVector, sym_u8_list_to_vector_);
+  proc_call_profile_.set(&Function::thunk<CallProfile>, sym_call_profile_);
 
   addBind("display", &proc_display_);
   addBind("newline", &proc_newline_);
   addBind("u8-list->vector", &proc_u8_list_to_vector_);
+  addBind("call-profile", &proc_call_profile_);
 
   addBind("&syntax", common->builtin()->amp_syntax());
   addBind("&lexical", common->builtin()->amp_lexical());
@@ -153,6 +158,41 @@ void LibKevesBase::procU8ListToVector_helper(KevesVM* vm, const_KevesIterator pc
   return KevesVM::returnValue(vm, pc);
 }
 
+// call-profile returns a vector of #(name calls inclusive exclusive) with
+// times in microseconds, most expensive first, or #f unless calls are
+// profiled. Builtins are named by their who.
+void LibKevesBase::CallProfile::func(KevesVM* vm, const_KevesIterator pc) {
+  const KevesCallProfile* profile(vm->call_profile());
+
+  if (!profile) {
+    vm->acc_ = EMB_FALSE;
+    return KevesVM::returnValue(vm, pc);
+  }
+
+  QVector<KevesCallProfile::Record> records(profile->records());
+  QHash<const CodeKev*, QString> names(nameCodesByBinds(vm->common()));
+  VectorKev* vector(vm->makeVector(records.size()));
+  KevesIterator iter(vector->begin());
+
+  for (auto record : records) {
+    VectorKev* entry(vm->makeVector(4));
+    KevesIterator field(entry->begin());
+
+    if (record.code)
+      *field++ = vm->makeString(KevesCallProfile::nameOf(vm->common(), names, record));
+    else
+      *field++ = record.who;
+
+    *field++ = KevesFixnum(static_cast<fx_int>(record.calls));
+    *field++ = KevesFixnum(static_cast<fx_int>(record.inclusive / 1000));
+    *field++ = KevesFixnum(static_cast<fx_int>(record.exclusive / 1000));
+    *iter++ = entry;
+  }
+
+  vm->acc_ = vector;
+  return KevesVM::returnValue(vm, pc);
+}
+
 
 ////////////////////////////////////////////////////////////////
 // for loading this as a dynamic library                      //
@@ -43,6 +43,8 @@ public:
   CPSKev proc_newline_;
   SymbolKev* sym_u8_list_to_vector_;
   CPSKev proc_u8_list_to_vector_;
+  SymbolKev* sym_call_profile_;
+  CPSKev proc_call_profile_;
 
 private:
   static void procDisplay(KevesVM*, const_KevesIterator);
@@ -53,4 +55,8 @@ private:
 
   static void procU8ListToVector(KevesVM* vm, const_KevesIterator pc);
   static void procU8ListToVector_helper(KevesVM* vm, const_KevesIterator pc);
+
+  struct CallProfile {
+    static void func(KevesVM*, const_KevesIterator);
+  };
 };
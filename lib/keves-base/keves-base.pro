@@ -14,6 +14,8 @@ HEADERS += keves-base.hpp \
            keves_common.hpp \
            keves_gc.hpp \
            keves_library.hpp \
+           keves_log.hpp \
+           keves_profile.hpp \
            keves_template.hpp \
            keves_textual_port.hpp \
            keves_vm.hpp \
@@ -36,6 +38,8 @@ SOURCES += keves-base.cpp \
            keves_common.cpp \
            keves_gc.cpp \
            keves_library.cpp \
+           keves_log.cpp \
+           keves_profile.cpp \
            keves_template.cpp \
            keves_textual_port.cpp \
            keves_vm.cpp \
@@ -49,3 +53,5 @@ SOURCES += keves-base.cpp \
 
 CONFIG += debug
 # CONFIG += qt release
+# DEFINES += KEVES_TRACE
+# DEFINES += KEVES_LOG_MIN_LEVEL=KEVES_LOG_INFO
@@ -27,6 +27,7 @@
 #include "keves_builtin_values.hpp"
 #include "keves_common.hpp"
 #include "keves_common-inl.hpp"
+#include "keves_log.hpp"
 #include "keves_template.hpp"
 #include "keves_vm.hpp"
 #include "kev/code.hpp"
@@ -48,7 +49,7 @@
 
 
 void LibRnrsBase::init(KevesCommon* common) {
-  std::cout << "LibRnrsBase::init()" << std::endl;
+  KEVES_LOG(KEVES_LOG_DEBUG) << "LibRnrsBase::init()";
 
   // setID("rnrs", "base-bin");
   // setVerNum(6);
@@ -65,6 +66,8 @@ void LibRnrsBase::init(KevesCommon* common) {
   sym_boolean_q_ = SymbolKev::make(common, "boolean?");
   sym_call_with_cc_ = SymbolKev::make(common, "call/cc");
   sym_call_with_current_continuation_ = SymbolKev::make(common, "call-with-current-continuation");
+  sym_call_with_ec_ = SymbolKev::make(common, "call/ec");
+  sym_call_with_escape_continuation_ = SymbolKev::make(common, "call-with-escape-continuation");
   sym_call_with_values_ = SymbolKev::make(common, "call-with-values");
   sym_car_ = SymbolKev::make(common, "car");
   sym_cdr_ = SymbolKev::make(common, "cdr");
@@ -197,11 +200,11 @@ void LibRnrsBase::init(KevesCommon* common) {
   proc_inexact_q_.set(&Function::predicate<IsNumber, IsInexact>, sym_inexact_q_);
   proc_flexact_.set(&Function::make<IsNumber, Flexact>, sym_flexact_);
   proc_inexact_.set(&Function::make<IsNumber, Inexact>, sym_inexact_);
-  proc_equal_.set(&Function::compare<IsNumber, IsEqualTo>, sym_equal_);
-  proc_less_than_.set(&Function::compare<IsReal, IsLessThan>, sym_less_than_);
-  proc_greater_than_.set(&Function::compare<IsReal, IsGreaterThan>, sym_greater_than_);
-  proc_less_than_equal_.set(&Function::compare<IsReal, IsLessThanEqual>, sym_less_than_equal_);
-  proc_greater_than_equal_.set(&Function::compare<IsReal, IsGreaterThanEqual>, sym_greater_than_equal_);
+  proc_equal_.set(&Function::compareFixnumFirst<IsNumber, IsEqualTo>, sym_equal_);
+  proc_less_than_.set(&Function::compareFixnumFirst<IsReal, IsLessThan>, sym_less_than_);
+  proc_greater_than_.set(&Function::compareFixnumFirst<IsReal, IsGreaterThan>, sym_greater_than_);
+  proc_less_than_equal_.set(&Function::compareFixnumFirst<IsReal, IsLessThanEqual>, sym_less_than_equal_);
+  proc_greater_than_equal_.set(&Function::compareFixnumFirst<IsReal, IsGreaterThanEqual>, sym_greater_than_equal_);
   proc_zero_q_.set(&Function::predicate<IsNumber, IsZero>, sym_zero_q_);
   proc_positive_q_.set(&Function::predicate<IsReal, IsPositive>, sym_positive_q_);
   proc_negative_q_.set(&Function::predicate<IsReal, IsNegative>, sym_negative_q_);
@@ -212,9 +215,9 @@ void LibRnrsBase::init(KevesCommon* common) {
   proc_nan_q_.set(&Function::predicate<IsReal, IsNaN>, sym_nan_q_);
   proc_max_.set(&Function::composeTwoOrMore<IsReal, Max>, sym_max_);
   proc_min_.set(&Function::composeTwoOrMore<IsReal, Min>, sym_min_);
-  proc_add_.set(&Arithmatic::func<Add, Add, fx_int, RationalNumberKevFromInt>, sym_add_);
+  proc_add_.set(&Arithmatic::func<Add, Add, fx_int, RationalNumberKevFromLong>, sym_add_);
   proc_multiply_.set(&Arithmatic::func<Multiply, Multiply, fx_long, RationalNumberKevFromLong>, sym_multiply_);
-  proc_subtract_.set(&Arithmatic::func<Subtract, Add, fx_int, RationalNumberKevFromInt>, sym_subtract_);
+  proc_subtract_.set(&Arithmatic::func<Subtract, Add, fx_int, RationalNumberKevFromLong>, sym_subtract_);
   proc_divide_.set(&Arithmatic::func<Divide, Multiply, fx_long, RationalNumberKevFromLong>, sym_divide_);
   proc_abs_.set(&Function::make<IsReal, Abs>, sym_abs_);
   proc_numerator_.set(&Function::make<IsReal, Numerator>, sym_numerator_);
@@ -297,6 +300,7 @@ void LibRnrsBase::init(KevesCommon* common) {
   proc_vector_to_list_.set(&Function::make<IsVector, VectorToList>, sym_vector_to_list_);
   proc_list_to_vector_.set(&procListToVector, sym_list_to_vector_);
   proc_call_with_cc_.set(&Function::make<IsProcedure, CallWithCC>, sym_call_with_cc_);
+  proc_call_with_ec_.set(&Function::make<IsProcedure, CallWithEC>, sym_call_with_ec_);
   proc_values_.set(&procValues, sym_values_);
   proc_call_with_values_.set(&Function::make<IsProcedure, IsProcedure, CallWithValues>, sym_call_with_values_);
   proc_dynamic_wind_.set(&Function::make<IsProcedure, IsProcedure, IsProcedure, DynamicWind>, sym_dynamic_wind_);
@@ -315,6 +319,8 @@ void LibRnrsBase::init(KevesCommon* common) {
   addBind("boolean?", &proc_boolean_q_);
   addBind("call/cc", &proc_call_with_cc_);
   addBind("call-with-current-continuation", &proc_call_with_cc_);
+  addBind("call/ec", &proc_call_with_ec_);
+  addBind("call-with-escape-continuation", &proc_call_with_ec_);
   addBind("call-with-values", &proc_call_with_values_);
   addBind("car", &proc_car_);
   addBind("cdr", &proc_cdr_);
@@ -456,18 +462,34 @@ bool LibRnrsBase::IsInexact::func(KevesValue kev) {
   return kev.isInexactNumber();
 }
 
+bool LibRnrsBase::IsLessThan::funcFixnum(fx_int num1, fx_int num2) {
+  return num1 < num2;
+}
+
 bool LibRnrsBase::IsLessThan::func(KevesValue num1, KevesValue num2) {
   return NumberKev::isLT(num1, num2);
 }
 
+bool LibRnrsBase::IsLessThanEqual::funcFixnum(fx_int num1, fx_int num2) {
+  return num1 <= num2;
+}
+
 bool LibRnrsBase::IsLessThanEqual::func(KevesValue num1, KevesValue num2) {
   return NumberKev::isLTE(num1, num2);
 }
 
+bool LibRnrsBase::IsGreaterThan::funcFixnum(fx_int num1, fx_int num2) {
+  return num1 > num2;
+}
+
 bool LibRnrsBase::IsGreaterThan::func(KevesValue num1, KevesValue num2) {
   return NumberKev::isGT(num1, num2);
 }
 
+bool LibRnrsBase::IsGreaterThanEqual::funcFixnum(fx_int num1, fx_int num2) {
+  return num1 >= num2;
+}
+
 bool LibRnrsBase::IsGreaterThanEqual::func(KevesValue num1, KevesValue num2) {
   return NumberKev::isGTE(num1, num2);
 }
@@ -496,8 +518,8 @@ bool LibRnrsBase::IsOdd::func(KevesValue kev) {
   }
 
   if (kev.is<FlonumKev>()) {
-    const FlonumKev* num(kev);
-    return num->isOdd();
+    const FlonumKev num(FlonumKev::fromKevesValue(kev));
+    return num.isOdd();
   }
 
   return false;
@@ -515,8 +537,8 @@ bool LibRnrsBase::IsEven::func(KevesValue kev) {
   }
 
   if (kev.is<FlonumKev>()) {
-    const FlonumKev* num(kev);
-    return num->isEven();
+    const FlonumKev num(FlonumKev::fromKevesValue(kev));
+    return num.isEven();
   }
 
   return false;
@@ -530,17 +552,17 @@ void LibRnrsBase::Flexact::func(KevesVM* vm, const_KevesIterator pc) {
 }
 
 void LibRnrsBase::Flexact::func_helper1(KevesVM* vm, const_KevesIterator pc) {
-  const FlonumKev* num(vm->acc_);
+  const FlonumKev num(FlonumKev::fromKevesValue(vm->acc_));
 
-  if (num->isNaN() || num->isInfinity())
+  if (num.isNaN() || num.isInfinity())
     return KevesVM::returnValue(vm, pc);
 
-  if (num->isZero()) {
+  if (num.isZero()) {
     vm->acc_ = KevesFixnum(0);
     return KevesVM::returnValue(vm, pc);
   }
   
-  RationalNumberKev rational(num->toExact(vm->gc()));
+  RationalNumberKev rational(num.toExact(vm->gc()));
   vm->acc_ = &rational;
   return KevesVM::returnValue(vm, pc);
 }
@@ -575,7 +597,7 @@ void LibRnrsBase::Inexact::func(KevesVM* vm, const_KevesIterator pc) {
 
     vm->checkStack(&flonum, &func, pc);
     
-    vm->acc_ = &flonum;
+    vm->acc_ = flonum.optimize();
     return KevesVM::returnValue(vm, pc);
   }
 
@@ -585,7 +607,7 @@ void LibRnrsBase::Inexact::func(KevesVM* vm, const_KevesIterator pc) {
 
     vm->checkStack(&flonum, &func, pc);
 
-    vm->acc_ = &flonum;
+    vm->acc_ = flonum.optimize();
     return KevesVM::returnValue(vm, pc);
   }
 
@@ -640,8 +662,8 @@ bool LibRnrsBase::IsRational::func(KevesValue kev) {
     return true;
 
   if (kev.is<FlonumKev>()) {
-    const FlonumKev* flonum(kev);
-    return flonum->isInteger();
+    const FlonumKev flonum(FlonumKev::fromKevesValue(kev));
+    return flonum.isInteger();
   }
 
   return false;
@@ -674,8 +696,8 @@ bool LibRnrsBase::IsInteger::func(KevesValue kev) {
   }
 
   if (kev.is<FlonumKev>()) {
-    const FlonumKev* flonum(kev);
-    return flonum->isInteger();
+    const FlonumKev flonum(FlonumKev::fromKevesValue(kev));
+    return flonum.isInteger();
   }
 
   return false;
@@ -695,8 +717,8 @@ bool LibRnrsBase::IsIntegerValued::func(KevesValue kev) {
   }
 
   if (kev.is<FlonumKev>()) {
-    const FlonumKev* flonum(kev);
-    return flonum->isInteger();
+    const FlonumKev flonum(FlonumKev::fromKevesValue(kev));
+    return flonum.isInteger();
   }
 
   if (kev.is<ExactComplexNumberKev>()) {
@@ -712,6 +734,10 @@ bool LibRnrsBase::IsIntegerValued::func(KevesValue kev) {
   return false;
 }
 
+bool LibRnrsBase::IsEqualTo::funcFixnum(fx_int num1, fx_int num2) {
+  return num1 == num2;
+}
+
 bool LibRnrsBase::IsEqualTo::func(KevesValue num1, KevesValue num2) {
   if (num1.isFixnum())
     return num2.isFixnum() && num1 == num2;
@@ -725,11 +751,11 @@ bool LibRnrsBase::IsEqualTo::func(KevesValue num1, KevesValue num2) {
     }
     
   } else if (num1.is<FlonumKev>()) {
-    const FlonumKev* real1(num1);
+    const FlonumKev real1(FlonumKev::fromKevesValue(num1));
 
     if (num2.is<FlonumKev>()) {
-      const FlonumKev* real2(num2);
-      return real1->isEqualTo(*real2);
+      const FlonumKev real2(FlonumKev::fromKevesValue(num2));
+      return real1.isEqualTo(real2);
     }
 
   } else if (num1.is<ExactComplexNumberKev>()) {
@@ -760,8 +786,8 @@ bool LibRnrsBase::IsFinite::func(KevesValue kev) {
     return true;
 
   if (kev.is<FlonumKev>()) {
-    const FlonumKev* num(kev);
-    return num->isFinite();
+    const FlonumKev num(FlonumKev::fromKevesValue(kev));
+    return num.isFinite();
   }
 
   return false;
@@ -769,8 +795,8 @@ bool LibRnrsBase::IsFinite::func(KevesValue kev) {
 
 bool LibRnrsBase::IsInfinite::func(KevesValue kev) {
   if (kev.is<FlonumKev>()) {
-    const FlonumKev* num(kev);
-    return num->isInfinity();
+    const FlonumKev num(FlonumKev::fromKevesValue(kev));
+    return num.isInfinity();
   }
 
   return false;
@@ -778,8 +804,8 @@ bool LibRnrsBase::IsInfinite::func(KevesValue kev) {
 
 bool LibRnrsBase::IsNaN::func(KevesValue kev) {
   if (kev.is<FlonumKev>()) {
-    const FlonumKev* num(kev);
-    return num->isNaN();
+    const FlonumKev num(FlonumKev::fromKevesValue(kev));
+    return num.isNaN();
   }
 
   return false;
@@ -837,14 +863,17 @@ void LibRnrsBase::Add::funcFixnumFixnum(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum augend(vm->gr1_);
   KevesFixnum addend(vm->acc_);
   fx_int sum(augend + addend);
-  KevesFixnum fixnum(sum);
 
-  if (fixnum == sum) {
-    vm->acc_ = fixnum;
+  if (KevesFixnum::isInRange(sum)) {
+    vm->acc_ = KevesFixnum(sum);
     return KevesVM::returnValue(vm, pc);
   }
 
-  vm->acc_ = RationalNumberKev::makeFromInt(vm->gc(), sum);
+  RationalNumberKevFromLong rational(sum);
+
+  vm->checkStack(&rational, &funcFixnumFixnum, pc);
+
+  vm->acc_ = &rational;
   return KevesVM::returnValue(vm, pc);
 }
   
@@ -860,13 +889,13 @@ void LibRnrsBase::Add::funcRationalFixnum(KevesVM* vm, const_KevesIterator pc) {
 }
 
 void LibRnrsBase::Add::funcFlonumFixnum(KevesVM* vm, const_KevesIterator pc) {
-  const FlonumKev* augend(vm->gr1_);
+  const FlonumKev augend(FlonumKev::fromKevesValue(vm->gr1_));
   KevesFixnum addend(vm->acc_);
-  FlonumKev sum(augend->add(addend));
+  FlonumKev sum(augend.add(addend));
 
   vm->checkStack(&sum, &funcFlonumFixnum, pc);
 
-  vm->acc_ = &sum;
+  vm->acc_ = sum.optimize();
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -921,12 +950,12 @@ void LibRnrsBase::Add::funcInexactComplexRational(KevesVM* vm, const_KevesIterat
 
 void LibRnrsBase::Add::funcFixnumFlonum(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum augend(vm->gr1_);
-  const FlonumKev* addend(vm->acc_);
-  FlonumKev sum(addend->add(augend));
+  const FlonumKev addend(FlonumKev::fromKevesValue(vm->acc_));
+  FlonumKev sum(addend.add(augend));
 
   vm->checkStack(&sum, &funcFixnumFlonum, pc);
 
-  vm->acc_ = &sum;
+  vm->acc_ = sum.optimize();
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1023,19 +1052,28 @@ void LibRnrsBase::Multiply::func1(KevesVM* vm, const_KevesIterator pc) {
 void LibRnrsBase::Multiply::funcFixnumFixnum(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum multiplicand(vm->gr1_);
   KevesFixnum multiplier(vm->acc_);
-  fx_long product(multiplicand * multiplier);
-  KevesFixnum fixnum(static_cast<fx_int>(product));
+  fx_long product;
+
+  if (!KevesFixnum::multiply(multiplicand, multiplier, &product)) {
+    RationalNumberKevFromLong rational(multiplicand);
+    RationalNumberKev big_product(rational.multiply(vm->gc(), multiplier));
+
+    vm->checkStack(&big_product, &funcFixnumFixnum, pc);
+
+    vm->acc_ = &big_product;
+    return KevesVM::returnValue(vm, pc);
+  }
 
-  if (fixnum != product) {
+  if (!KevesFixnum::isInRange(product)) {
     RationalNumberKevFromLong rational(product);
     
-    vm->checkStack(&product, &funcFixnumFixnum, pc);
+    vm->checkStack(&rational, &funcFixnumFixnum, pc);
     
     vm->acc_ = &rational;
     return KevesVM::returnValue(vm, pc);
   }
   
-  vm->acc_ = fixnum;
+  vm->acc_ = KevesFixnum(static_cast<fx_int>(product));
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1051,13 +1089,13 @@ void LibRnrsBase::Multiply::funcRationalFixnum(KevesVM* vm, const_KevesIterator
 }
 
 void LibRnrsBase::Multiply::funcFlonumFixnum(KevesVM* vm, const_KevesIterator pc) {
-  const FlonumKev* multiplicand(vm->gr1_);
+  const FlonumKev multiplicand(FlonumKev::fromKevesValue(vm->gr1_));
   KevesFixnum multiplier(vm->acc_);
-  FlonumKev product(multiplicand->multiply(multiplier));
+  FlonumKev product(multiplicand.multiply(multiplier));
 
   vm->checkStack(&product, &funcFlonumFixnum, pc);
 
-  vm->acc_ = &product;
+  vm->acc_ = product.optimize();
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1112,12 +1150,12 @@ void LibRnrsBase::Multiply::funcInexactComplexRational(KevesVM* vm, const_KevesI
 
 void LibRnrsBase::Multiply::funcFixnumFlonum(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum multiplicand(vm->gr1_);
-  const FlonumKev* multiplier(vm->acc_);
-  FlonumKev product(multiplier->multiply(multiplicand));
+  const FlonumKev multiplier(FlonumKev::fromKevesValue(vm->acc_));
+  FlonumKev product(multiplier.multiply(multiplicand));
 
   vm->checkStack(&product, &funcFixnumFlonum, pc);
 
-  vm->acc_ = &product;
+  vm->acc_ = product.optimize();
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1166,12 +1204,12 @@ void LibRnrsBase::Multiply::funcInexactComplexExactComplex(KevesVM* vm, const_Ke
 
 void LibRnrsBase::Multiply::funcFixnumInexactComplex(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum multiplicand(vm->gr1_);
-  const FlonumKev* multiplier(vm->acc_);
-  FlonumKev product(multiplier->multiply(multiplicand));
+  const FlonumKev multiplier(FlonumKev::fromKevesValue(vm->acc_));
+  FlonumKev product(multiplier.multiply(multiplicand));
 
   vm->checkStack(&product, &funcFixnumInexactComplex, pc);
 
-  vm->acc_ = &product;
+  vm->acc_ = product.optimize();
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1213,7 +1251,7 @@ void LibRnrsBase::Subtract::func1(KevesVM* vm, const_KevesIterator pc) {
     return KevesVM::returnValue(vm, pc);
   }
   
-  RationalNumberKevFromInt rational(inverse);
+  RationalNumberKevFromLong rational(inverse);
 
   vm->checkStack(&rational, &func1, pc);
 
@@ -1242,12 +1280,12 @@ void LibRnrsBase::Subtract::func3(KevesVM* vm, const_KevesIterator pc) {
   if (!last.is<FlonumKev>())
     return func4(vm, pc);
   
-  const FlonumKev* num(last);
-  FlonumKev inverse(num->inverse());
+  const FlonumKev num(FlonumKev::fromKevesValue(last));
+  FlonumKev inverse(num.inverse());
 
   vm->checkStack(&inverse, &func3, pc);
 
-  vm->acc_ = &inverse;
+  vm->acc_ = inverse.optimize();
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1292,10 +1330,9 @@ void LibRnrsBase::Subtract::funcFixnumFixnum(KevesVM* vm, const_KevesIterator pc
   KevesFixnum minuend(vm->gr1_);
   KevesFixnum subtrahend(vm->acc_);
   fx_int difference(minuend - subtrahend);
-  KevesFixnum fixnum(difference);
 
-  if (fixnum != difference) {
-    RationalNumberKevFromInt rational(difference);
+  if (!KevesFixnum::isInRange(difference)) {
+    RationalNumberKevFromLong rational(difference);
     
     vm->checkStack(&rational, &funcFixnumFixnum, pc);
     
@@ -1303,7 +1340,7 @@ void LibRnrsBase::Subtract::funcFixnumFixnum(KevesVM* vm, const_KevesIterator pc
     return KevesVM::returnValue(vm, pc);
   }
 
-  vm->acc_ = fixnum;
+  vm->acc_ = KevesFixnum(difference);
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1319,13 +1356,13 @@ void LibRnrsBase::Subtract::funcRationalFixnum(KevesVM* vm, const_KevesIterator
 }
 
 void LibRnrsBase::Subtract::funcFlonumFixnum(KevesVM* vm, const_KevesIterator pc) {
-  const FlonumKev* minuend(vm->gr1_);
+  const FlonumKev minuend(FlonumKev::fromKevesValue(vm->gr1_));
   KevesFixnum subtrahend(vm->acc_);
-  FlonumKev difference(minuend->subtract(subtrahend));
+  FlonumKev difference(minuend.subtract(subtrahend));
 
   vm->checkStack(&difference, &funcFlonumFixnum, pc);
 
-  vm->acc_ = &difference;
+  vm->acc_ = difference.optimize();
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1376,12 +1413,12 @@ void LibRnrsBase::Subtract::funcInexactComplexRational(KevesVM* vm, const_KevesI
 
 void LibRnrsBase::Subtract::funcFixnumFlonum(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum minuend(vm->gr1_);
-  const FlonumKev* subtrahend(vm->acc_);
-  FlonumKev difference(NumberKev::difference(minuend, *subtrahend));
+  const FlonumKev subtrahend(FlonumKev::fromKevesValue(vm->acc_));
+  FlonumKev difference(NumberKev::difference(minuend, subtrahend));
 
   vm->checkStack(&difference, &funcFixnumFlonum, pc);
 
-  vm->acc_ = &difference;
+  vm->acc_ = difference.optimize();
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1430,12 +1467,12 @@ void LibRnrsBase::Subtract::funcInexactComplexExactComplex(KevesVM* vm, const_Ke
 
 void LibRnrsBase::Subtract::funcFixnumInexactComplex(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum  minuend(vm->gr1_);
-  const FlonumKev* subtrahend(vm->acc_);
-  FlonumKev difference(NumberKev::difference(minuend, *subtrahend));
+  const FlonumKev subtrahend(FlonumKev::fromKevesValue(vm->acc_));
+  FlonumKev difference(NumberKev::difference(minuend, subtrahend));
 
   vm->checkStack(&difference, &funcFixnumInexactComplex, pc);
 
-  vm->acc_ = &difference;
+  vm->acc_ = difference.optimize();
   return KevesVM::returnValue(vm, pc);
 }
 
@@ -1482,7 +1519,7 @@ void LibRnrsBase::Divide::func1(KevesVM* vm, const_KevesIterator pc) {
       return KevesVM::returnValue(vm, pc);
     }
 
-    RationalNumberKevFromInt quotient(numerator, denominator);
+    RationalNumberKevFromLong quotient(numerator, denominator);
     vm->acc_ = &quotient;
     return KevesVM::returnValueSafe(vm, pc);
   }
@@ -1495,9 +1532,9 @@ void LibRnrsBase::Divide::func1(KevesVM* vm, const_KevesIterator pc) {
   }
 
   if (last.is<FlonumKev>()) {
-    const FlonumKev* divisor(last);
-    FlonumKev quotient(divisor->reciprocal());
-    vm->acc_ = &quotient;
+    const FlonumKev divisor(FlonumKev::fromKevesValue(last));
+    FlonumKev quotient(divisor.reciprocal());
+    vm->acc_ = quotient.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
 
@@ -1524,7 +1561,7 @@ void LibRnrsBase::Divide::func1(KevesVM* vm, const_KevesIterator pc) {
 void LibRnrsBase::Divide::funcFixnumFixnum(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum dividend(vm->gr1_);
   KevesFixnum divisor(vm->acc_);
-  RationalNumberKevFromInt quotient(dividend, divisor);
+  RationalNumberKevFromLong quotient(dividend, divisor);
   vm->acc_ = quotient.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
@@ -1538,10 +1575,10 @@ void LibRnrsBase::Divide::funcRationalFixnum(KevesVM* vm, const_KevesIterator pc
 }
 
 void LibRnrsBase::Divide::funcFlonumFixnum(KevesVM* vm, const_KevesIterator pc) {
-  const FlonumKev* dividend(vm->gr1_);
+  const FlonumKev dividend(FlonumKev::fromKevesValue(vm->gr1_));
   KevesFixnum divisor(vm->acc_);
-  FlonumKev quotient(dividend->divide(divisor));
-  vm->acc_ = &quotient;
+  FlonumKev quotient(dividend.divide(divisor));
+  vm->acc_ = quotient.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
@@ -1587,9 +1624,9 @@ void LibRnrsBase::Divide::funcInexactComplexRational(KevesVM* vm, const_KevesIte
 
 void LibRnrsBase::Divide::funcFixnumFlonum(KevesVM* vm, const_KevesIterator pc) {
   KevesFixnum dividend(vm->gr1_);
-  const FlonumKev* divisor(vm->acc_);
-  FlonumKev quotient(NumberKev::quotient(dividend, *divisor));
-  vm->acc_ = &quotient;
+  const FlonumKev divisor(FlonumKev::fromKevesValue(vm->acc_));
+  FlonumKev quotient(NumberKev::quotient(dividend, divisor));
+  vm->acc_ = quotient.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
@@ -1672,9 +1709,9 @@ void LibRnrsBase::Abs::func(KevesVM* vm, const_KevesIterator pc) {
   }
 
   if (vm->acc_.is<FlonumKev>()) {
-    const FlonumKev* org(vm->acc_);
-    FlonumKev abs_num(org->abs());
-    vm->acc_ = &abs_num;
+    const FlonumKev org(FlonumKev::fromKevesValue(vm->acc_));
+    FlonumKev abs_num(org.abs());
+    vm->acc_ = abs_num.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
 
@@ -1696,23 +1733,23 @@ void LibRnrsBase::Numerator::func(KevesVM* vm, const_KevesIterator pc) {
   }
   
   if (vm->acc_.is<FlonumKev>()) {
-    const FlonumKev* num(vm->acc_);
+    const FlonumKev num(FlonumKev::fromKevesValue(vm->acc_));
 
-    if (num->isNaN() || num->isInfinity()) {
+    if (num.isNaN() || num.isInfinity()) {
       vm->acc_ = vm->gr2_;
       vm->gr1_ = vm->common()->getMesgText(KevesBuiltinValues::mesg_ReqRealNum);
       vm->gr2_ = EMB_NULL;
       return KevesVM::raiseAssertCondition(vm, pc);
     }
     
-    if (num->isZero()) {
+    if (num.isZero()) {
       vm->acc_ = KevesFixnum(0);
       return KevesVM::returnValue(vm, pc);
     }
     
-    RationalNumberKev rational(num->toExact(vm->gc()));
+    RationalNumberKev rational(num.toExact(vm->gc()));
     FlonumKev flonum(rational.makeMPQ().get_num().get_d());
-    vm->acc_ = &flonum;
+    vm->acc_ = flonum.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
   
@@ -1735,23 +1772,23 @@ void LibRnrsBase::Denominator::func(KevesVM* vm, const_KevesIterator pc) {
   }
 
   if (vm->acc_.is<FlonumKev>()) {
-    const FlonumKev* num(vm->acc_);
+    const FlonumKev num(FlonumKev::fromKevesValue(vm->acc_));
     
-    if (num->isNaN() || num->isInfinity()) {
+    if (num.isNaN() || num.isInfinity()) {
       vm->acc_ = vm->gr2_;
       vm->gr1_ = vm->common()->getMesgText(KevesBuiltinValues::mesg_ReqRealNum);
       vm->gr2_ = EMB_NULL;
       return KevesVM::raiseAssertCondition(vm, pc);
     }
     
-    if (num->isZero()) {
+    if (num.isZero()) {
       vm->acc_ = KevesFixnum(1);
       return KevesVM::returnValue(vm, pc);
     }
     
-    RationalNumberKev rational(num->toExact(vm->gc()));
+    RationalNumberKev rational(num.toExact(vm->gc()));
     FlonumKev flonum(rational.makeMPQ().get_den().get_d());
-    vm->acc_ = &flonum;
+    vm->acc_ = flonum.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
   
@@ -1770,9 +1807,9 @@ void LibRnrsBase::Floor::func(KevesVM* vm, const_KevesIterator pc) {
   }
 
   if (vm->acc_.is<FlonumKev>()) {
-    const FlonumKev* flonum(vm->acc_);
-    FlonumKev floor_num(flonum->floor());
-    vm->acc_ = &floor_num;
+    const FlonumKev flonum(FlonumKev::fromKevesValue(vm->acc_));
+    FlonumKev floor_num(flonum.floor());
+    vm->acc_ = floor_num.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
   
@@ -1791,9 +1828,9 @@ void LibRnrsBase::Ceiling::func(KevesVM* vm, const_KevesIterator pc) {
   }
 
   if (vm->acc_.is<FlonumKev>()) {
-    const FlonumKev* flonum(vm->acc_);
-    FlonumKev ceiling_num(flonum->ceiling());
-    vm->acc_ = &ceiling_num;
+    const FlonumKev flonum(FlonumKev::fromKevesValue(vm->acc_));
+    FlonumKev ceiling_num(flonum.ceiling());
+    vm->acc_ = ceiling_num.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
 
@@ -1812,9 +1849,9 @@ void LibRnrsBase::Truncate::func(KevesVM* vm, const_KevesIterator pc) {
   }
 
   if (vm->acc_.is<FlonumKev>()) {
-    const FlonumKev* flonum(vm->acc_);
-    FlonumKev truncate_num(flonum->truncate());
-    vm->acc_ = &truncate_num;
+    const FlonumKev flonum(FlonumKev::fromKevesValue(vm->acc_));
+    FlonumKev truncate_num(flonum.truncate());
+    vm->acc_ = truncate_num.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
 
@@ -1833,9 +1870,9 @@ void LibRnrsBase::Round::func(KevesVM* vm, const_KevesIterator pc) {
   }
 
   if (vm->acc_.is<FlonumKev>()) {
-    const FlonumKev* flonum(vm->acc_);
-    FlonumKev round_num(flonum->round());
-    vm->acc_ = &round_num;
+    const FlonumKev flonum(FlonumKev::fromKevesValue(vm->acc_));
+    FlonumKev round_num(flonum.round());
+    vm->acc_ = round_num.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
 
@@ -1851,7 +1888,7 @@ void LibRnrsBase::MakePolar::func(KevesVM* vm, const_KevesIterator pc) {
   FlonumKev ang(NumberKev::makeFlonum(vm->gr1_));
   FlonumKev real_part(mag.multiply(ang.cos()));
   FlonumKev imag_part(mag.multiply(ang.sin()));
-  vm->acc_ = &real_part;
+  vm->acc_ = real_part.optimize();
   vm->gr1_ = &imag_part;
   return KevesVM::makeRectangular(vm, pc);
 }
@@ -1870,7 +1907,7 @@ void LibRnrsBase::RealPart::func(KevesVM* vm, const_KevesIterator pc) {
   if (vm->acc_.is<InexactComplexNumberKev>()) {
     const InexactComplexNumberKev* complex(vm->acc_);
     FlonumKev real(complex->real());
-    vm->acc_ = &real;
+    vm->acc_ = real.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
   
@@ -1885,7 +1922,7 @@ void LibRnrsBase::ImagPart::func(KevesVM* vm, const_KevesIterator pc) {
 
   if (vm->acc_.is<FlonumKev>()) {
     FlonumKev nan(std::numeric_limits<double>::quiet_NaN());
-    vm->acc_ = &nan;
+    vm->acc_ = nan.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
 
@@ -1899,7 +1936,7 @@ void LibRnrsBase::ImagPart::func(KevesVM* vm, const_KevesIterator pc) {
   if (vm->acc_.is<InexactComplexNumberKev>()) {
     const InexactComplexNumberKev* complex(vm->acc_);
     FlonumKev imag(complex->imag());
-    vm->acc_ = &imag;
+    vm->acc_ = imag.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
   
@@ -1917,7 +1954,7 @@ void LibRnrsBase::Magnitude::func(KevesVM* vm, const_KevesIterator pc) {
     FlonumKev real_part2(real_part.multiply(real_part));
     FlonumKev imag_part2(imag_part.multiply(imag_part));
     FlonumKev mag(real_part2.add(imag_part2).sqrt());
-    vm->acc_ = &mag;
+    vm->acc_ = mag.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   };
 
@@ -1937,14 +1974,14 @@ void LibRnrsBase::Magnitude::func(KevesVM* vm, const_KevesIterator pc) {
 void LibRnrsBase::Angle::func(KevesVM* vm, const_KevesIterator pc) {
   if (vm->acc_.isRealNumber()) {
     FlonumKev ang(NumberKev::isNegative(vm->acc_) ? acos(-1.0) : 0.0);
-    vm->acc_ = &ang;
+    vm->acc_ = ang.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
   
   auto angle = [&](const FlonumKev& real_part, const FlonumKev& imag_part) {
     if (real_part.isZero()) {
       FlonumKev r(imag_part.isNegative() ? -acos(0.0) : acos(0.0));
-      vm->acc_ = &r;
+      vm->acc_ = r.optimize();
       return KevesVM::returnValueSafe(vm, pc);
     }
     
@@ -1952,12 +1989,12 @@ void LibRnrsBase::Angle::func(KevesVM* vm, const_KevesIterator pc) {
       FlonumKev r(imag_part.divide(real_part).atan());
       FlonumKev pi(acos(-1.0));
       FlonumKev r2(r.isNegative() ? r.add(pi) : r.subtract(pi));
-      vm->acc_ = &r2;
+      vm->acc_ = r2.optimize();
       return KevesVM::returnValueSafe(vm, pc);
     }
     
     FlonumKev r(imag_part.divide(real_part).atan());
-    vm->acc_ = &r;
+    vm->acc_ = r.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   };
 
@@ -2135,7 +2172,7 @@ void LibRnrsBase::procStringToNumber_helper1(KevesVM* vm, const_KevesIterator pc
     }
     
     FlonumKev flonum(NumberKev::makeFlonum(number1));
-    vm->acc_ = &flonum;
+    vm->acc_ = flonum.optimize();
     return KevesVM::returnValueSafe(vm, pc);
   }
 
@@ -2184,7 +2221,7 @@ void LibRnrsBase::procStringToNumber_helper1(KevesVM* vm, const_KevesIterator pc
       
       FlonumKev flonum1(NumberKev::makeFlonum(number1));
       FlonumKev flonum2(NumberKev::makeFlonum(number2));
-      vm->acc_ = &flonum1;
+      vm->acc_ = flonum1.optimize();
       vm->gr1_ = &flonum2;
       return KevesVM::makeRectangular(vm, pc);
     }
@@ -2206,7 +2243,7 @@ void LibRnrsBase::procStringToNumber_helper1(KevesVM* vm, const_KevesIterator pc
 	FlonumKev ang(NumberKev::makeFlonum(number2));
 	FlonumKev real_part(mag.multiply(ang.cos()));
 	FlonumKev imag_part(mag.multiply(ang.sin()));
-	vm->acc_ = &real_part;
+	vm->acc_ = real_part.optimize();
 	vm->gr1_ = &imag_part;
 	return KevesVM::makeRectangular(vm, pc);
       }
@@ -2220,56 +2257,56 @@ void LibRnrsBase::procStringToNumber_helper1(KevesVM* vm, const_KevesIterator pc
 void LibRnrsBase::Flexp::func(KevesVM* vm, const_KevesIterator pc) {
   FlonumKev flonum(NumberKev::makeFlonum(vm->acc_));
   FlonumKev r(flonum.exp());
-  vm->acc_ = &r;
+  vm->acc_ = r.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
 void LibRnrsBase::Fllog::func(KevesVM* vm, const_KevesIterator pc) {
   FlonumKev flonum(NumberKev::makeFlonum(vm->acc_));
   FlonumKev r(flonum.log());
-  vm->acc_ = &r;
+  vm->acc_ = r.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
 void LibRnrsBase::Flsin::func(KevesVM* vm, const_KevesIterator pc) {
   FlonumKev flonum(NumberKev::makeFlonum(vm->acc_));
   FlonumKev r(flonum.sin());
-  vm->acc_ = &r;
+  vm->acc_ = r.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
 void LibRnrsBase::Flcos::func(KevesVM* vm, const_KevesIterator pc) {
   FlonumKev flonum(NumberKev::makeFlonum(vm->acc_));
   FlonumKev r(flonum.cos());
-  vm->acc_ = &r;
+  vm->acc_ = r.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
 void LibRnrsBase::Fltan::func(KevesVM* vm, const_KevesIterator pc) {
   FlonumKev flonum(NumberKev::makeFlonum(vm->acc_));
   FlonumKev r(flonum.tan());
-  vm->acc_ = &r;
+  vm->acc_ = r.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
 void LibRnrsBase::Flasin::func(KevesVM* vm, const_KevesIterator pc) {
   FlonumKev flonum(NumberKev::makeFlonum(vm->acc_));
   FlonumKev r(flonum.asin());
-  vm->acc_ = &r;
+  vm->acc_ = r.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
 void LibRnrsBase::Flacos::func(KevesVM* vm, const_KevesIterator pc) {
   FlonumKev flonum(NumberKev::makeFlonum(vm->acc_));
   FlonumKev r(flonum.acos());
-  vm->acc_ = &r;
+  vm->acc_ = r.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
 void LibRnrsBase::Flatan::func(KevesVM* vm, const_KevesIterator pc) {
   FlonumKev flonum(NumberKev::makeFlonum(vm->acc_));
   FlonumKev r(flonum.atan());
-  vm->acc_ = &r;
+  vm->acc_ = r.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
@@ -2284,7 +2321,7 @@ void LibRnrsBase::Flsqrt::func(KevesVM* vm, const_KevesIterator pc) {
   }
 
   FlonumKev r(flonum.sqrt());
-  vm->acc_ = &r;
+  vm->acc_ = r.optimize();
   return KevesVM::returnValueSafe(vm, pc);
 }
 
@@ -2298,7 +2335,7 @@ void LibRnrsBase::procFlexpt(KevesVM* vm, const_KevesIterator pc) {
       FlonumKev fl_x1(NumberKev::makeFlonum(x1));
       FlonumKev fl_x2(NumberKev::makeFlonum(x2));
       FlonumKev r(fl_x1.expt(fl_x2));
-      vm->acc_ = &r;
+      vm->acc_ = r.optimize();
       return KevesVM::returnValueSafe(vm, pc);
     }
 
@@ -3071,7 +3108,7 @@ void LibRnrsBase::CallWithCC::func(KevesVM* vm, const_KevesIterator pc) {
   
   vm->checkStack(&arg_frame, &func, pc);
   
-  pc = registers->unwind();
+  pc = vm->unwindFrame();
   
   ContinuationKev conti_obj(*registers);
   StackFrameKev stack_frame;
@@ -3083,14 +3120,43 @@ void LibRnrsBase::CallWithCC::func(KevesVM* vm, const_KevesIterator pc) {
   return KevesVM::cmd_APPLY(vm, pc);
 }
 
-void LibRnrsBase::CallWithValues::func(KevesVM* vm, const_KevesIterator pc) {
+// An escape only keeps the frame to return to, so it costs no copy of the
+// registers. It expires when *proc* returns, when it is taken, or when
+// control leaves its extent by another escape or a continuation.
+void LibRnrsBase::CallWithEC::func(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev* registers(&vm->registers_);
   ArgumentFrameKevWithArray<04> arg_frame1;
   ArgumentFrameKevWithArray<04> arg_frame2;
   
   vm->checkStack(&arg_frame1, &func, pc);
   
-  pc = registers->unwind();
+  pc = vm->unwindFrame();
+  
+  // wind and push *escape*
+  StackFrameKev stack_frame1;
+  registers->wind(pc, &stack_frame1, &arg_frame1);
+  pc = vm->common()->builtin()->code_EXPIRE_ESCAPE();
+  EscapeKev escape(&stack_frame1, registers->escapes());
+  registers->pushArgument(&escape);
+  registers->set_escapes(&escape);
+  
+  // wind and apply *proc*
+  StackFrameKev stack_frame2;
+  registers->wind(pc, &stack_frame2, &arg_frame2);
+  registers->pushArgument(vm->acc_);
+  registers->pushArgument(&escape);
+  
+  return KevesVM::cmd_APPLY(vm, pc);
+}
+
+void LibRnrsBase::CallWithValues::func(KevesVM* vm, const_KevesIterator pc) {
+  StackFrameKev* registers(&vm->registers_);
+  ArgumentFrameKevWithArray<010> arg_frame1; // for *proc2* and values
+  ArgumentFrameKevWithArray<04> arg_frame2;
+  
+  vm->checkStack(&arg_frame1, &func, pc);
+  
+  pc = vm->unwindFrame();
   
   // wind and push *proc2*
   StackFrameKev stack_frame1;
@@ -3102,7 +3168,7 @@ void LibRnrsBase::CallWithValues::func(KevesVM* vm, const_KevesIterator pc) {
   StackFrameKev stack_frame2;
   registers->wind(pc, &stack_frame2, &arg_frame2);
   registers->pushArgument(vm->acc_);
-  vm->keves_vals_ = nullptr;
+  vm->valn_ = 0;
   vm->gr2_ = vm->gr1_;
   vm->gr1_ = vm->acc_;
   return KevesVM::cmd_APPLY(vm, pc);
@@ -3113,10 +3179,9 @@ void LibRnrsBase::procValues(KevesVM* vm, const_KevesIterator pc) {
 
   if (registers->argn() > 1) {
     vm->acc_ = registers->argument(1);
-    vm->keves_vals_ = registers->argp();
-    vm->keves_vals_->assign(0, KevesFixnum(registers->argn()));
+    vm->keepValues(registers->argp(), registers->argn());
   } else {
-    vm->keves_vals_ = nullptr;
+    vm->valn_ = 0;
     vm->acc_ = EMB_UNDEF;
   }
 
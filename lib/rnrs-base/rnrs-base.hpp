@@ -316,6 +316,9 @@ public:
   SymbolKev* sym_call_with_current_continuation_;
   SymbolKev* sym_call_with_cc_;
   CPSKev proc_call_with_cc_;
+  SymbolKev* sym_call_with_escape_continuation_;
+  SymbolKev* sym_call_with_ec_;
+  CPSKev proc_call_with_ec_;
   SymbolKev* sym_values_;
   CPSKev proc_values_;
   SymbolKev* sym_call_with_values_;
@@ -352,6 +355,7 @@ private:
 
   struct IsEqualTo {
     static bool func(KevesValue, KevesValue);
+    static bool funcFixnum(fx_int, fx_int);
   };
 
   struct IsExact {
@@ -364,10 +368,12 @@ private:
 
   struct IsGreaterThan {
     static bool func(KevesValue, KevesValue);
+    static bool funcFixnum(fx_int, fx_int);
   };
 
   struct IsGreaterThanEqual {
     static bool func(KevesValue, KevesValue);
+    static bool funcFixnum(fx_int, fx_int);
   };
 
   struct IsInexact {
@@ -389,10 +395,12 @@ private:
 
   struct IsLessThan {
     static bool func(KevesValue, KevesValue);
+    static bool funcFixnum(fx_int, fx_int);
   };
 
   struct IsLessThanEqual {
     static bool func(KevesValue, KevesValue);
+    static bool funcFixnum(fx_int, fx_int);
   };
 
   struct IsNaN {
@@ -506,8 +514,9 @@ private:
       return KevesVM::returnValueSafe(vm, pc);
     }
 
-    static fx_int func(KevesFixnum num1, KevesFixnum num2) {
-      return num1 + num2;
+    static bool func(KevesFixnum num1, KevesFixnum num2, fx_int* sum) {
+      *sum = num1 + num2; // never overflows, fixnums are narrower than fx_int
+      return true;
     }
 
     template<class T>
@@ -578,8 +587,8 @@ private:
       return KevesVM::returnValueSafe(vm, pc);
     }
 
-    static fx_long func(KevesFixnum num1, KevesFixnum num2) {
-      return static_cast<fx_long>(num1) * static_cast<fx_long>(num2);
+    static bool func(KevesFixnum num1, KevesFixnum num2, fx_long* product) {
+      return KevesFixnum::multiply(num1, num2, product);
     }
 
     template<class T>
@@ -1009,6 +1018,10 @@ private:
     static void func(KevesVM*, const_KevesIterator);
   };
 
+  struct CallWithEC {
+    static void func(KevesVM*, const_KevesIterator);
+  };
+
   static void procValues(KevesVM*, const_KevesIterator);
 
   struct CallWithValues {
@@ -16,6 +16,8 @@ HEADERS += rnrs-base.hpp \
            keves_gc.hpp \
            keves_gc-inl.hpp \
            keves_library.hpp \
+           keves_log.hpp \
+           keves_profile.hpp \
            keves_template.hpp \
            keves_textual_port.hpp \
            keves_vm.hpp \
@@ -44,13 +46,16 @@ HEADERS += rnrs-base.hpp \
            kev/vector.hpp \
            kev/vector-inl.hpp \
            value/char.hpp \
-           value/fixnum.hpp
+           value/fixnum.hpp \
+           value/flonum.hpp
 
 SOURCES += rnrs-base.cpp \
            keves_builtin_values.cpp \
            keves_common.cpp \
            keves_gc.cpp \
            keves_library.cpp \
+           keves_log.cpp \
+           keves_profile.cpp \
            keves_template.cpp \
            keves_textual_port.cpp \
            keves_vm.cpp \
@@ -71,3 +76,5 @@ SOURCES += rnrs-base.cpp \
 
 CONFIG += debug
 # CONFIG += qt release
+# DEFINES += KEVES_TRACE
+# DEFINES += KEVES_LOG_MIN_LEVEL=KEVES_LOG_INFO
@@ -27,6 +27,7 @@
 #include "keves_builtin_values.hpp"
 #include "keves_common.hpp"
 #include "keves_common-inl.hpp"
+#include "keves_log.hpp"
 #include "keves_template.hpp"
 #include "keves_vm.hpp"
 #include "kev/code.hpp"
@@ -40,7 +41,7 @@
 
 
 void LibRnrsExceptions::init(KevesCommon* common) {
-  std::cout << "LibRnrsExceptions::init()" << std::endl;
+  KEVES_LOG(KEVES_LOG_DEBUG) << "LibRnrsExceptions::init()";
 
   // setID("rnrs", "exceptions-bin");
   // setVerNum(6);
@@ -60,12 +61,12 @@ void LibRnrsExceptions::Raise::func(KevesVM* vm, const_KevesIterator pc) {
 
   if (StackFrameKev::isBottom(registers)) {
     pc = vm->common()->builtin()->code_HALT();
-    std::cout << "raise!!!!!!!!!!!!!" << std::endl; 
+    KEVES_LOG(KEVES_LOG_DEBUG) << "raise: not caught";
     vm->gr1_ = last;
     return KevesVM::pushGr1ToArgument(vm, pc);
   }
 
-  std::cout << "catch exception!!!!!!!!!!!!!" << std::endl; 
+  KEVES_LOG(KEVES_LOG_DEBUG) << "raise: caught";
   pc = registers->pc();
   vm->acc_ = last;
   return KevesVM::pushGr1ToArgument(vm, pc);
@@ -27,6 +27,7 @@
 #include "keves_builtin_values.hpp"
 #include "keves_common.hpp"
 #include "keves_common-inl.hpp"
+#include "keves_log.hpp"
 #include "keves_template.hpp"
 #include "keves_vm.hpp"
 #include "kev/code.hpp"
@@ -41,7 +42,7 @@
 
 
 void LibRnrsLists::init(KevesCommon* common) {
-  std::cout << "LibRnrsLists::init()" << std::endl;
+  KEVES_LOG(KEVES_LOG_DEBUG) << "LibRnrsLists::init()";
 
   // setID("rnrs", "lists-bin");
   // setVerNum(6);
@@ -14,6 +14,8 @@ HEADERS += rnrs-lists.hpp \
            keves_builtin_values.hpp \
            keves_common.hpp \
            keves_library.hpp \
+           keves_log.hpp \
+           keves_profile.hpp \
            keves_template.hpp \
            keves_textual_port.hpp \
            keves_vm.hpp \
@@ -31,6 +33,8 @@ SOURCES += rnrs-lists.cpp \
            keves_builtin_values.cpp \
            keves_common.cpp \
            keves_library.cpp \
+           keves_log.cpp \
+           keves_profile.cpp \
            keves_template.cpp \
            keves_textual_port.cpp \
            keves_vm.cpp \
@@ -42,3 +46,5 @@ SOURCES += rnrs-lists.cpp \
 
 CONFIG += debug
 # CONFIG += qt release
+# DEFINES += KEVES_TRACE
+# DEFINES += KEVES_LOG_MIN_LEVEL=KEVES_LOG_INFO
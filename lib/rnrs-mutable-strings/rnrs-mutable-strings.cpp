@@ -20,6 +20,7 @@
 #include "rnrs-mutable-strings.hpp"
 
 #include "keves_builtin_values.hpp"
+#include "keves_log.hpp"
 #include "keves_template.hpp"
 #include "kev/procedure.hpp"
 #include "kev/string.hpp"
@@ -28,7 +29,7 @@
 
 
 void LibRnrsMutableStrings::init(KevesCommon* common) {
-  std::cout << "LibRnrsMutableStrings::init()" << std::endl;
+  KEVES_LOG(KEVES_LOG_DEBUG) << "LibRnrsMutableStrings::init()";
 
   // setID("rnrs", "mutable-strings-bin");
   // setVerNum(6);
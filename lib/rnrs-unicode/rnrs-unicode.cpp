@@ -27,6 +27,7 @@
 #include "keves_builtin_values.hpp"
 #include "keves_common.hpp"
 #include "keves_common-inl.hpp"
+#include "keves_log.hpp"
 #include "keves_template.hpp"
 #include "keves_vm.hpp"
 #include "kev/code.hpp"
@@ -40,7 +41,7 @@
 
 
 void LibRnrsUnicode::init(KevesCommon* common) {
-  std::cout << "LibRnrsUnicode::init()" << std::endl;
+  KEVES_LOG(KEVES_LOG_DEBUG) << "LibRnrsUnicode::init()";
 
   // setID("rnrs", "unicode-bin");
   // setVerNum(6);
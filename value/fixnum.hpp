@@ -25,8 +25,13 @@
 
 class KevesFixnum {
 public:
-  static constexpr qint32 MAX_VALUE = 0x1fffffff;
-  static constexpr qint32 MIN_VALUE = -0x20000000;
+#if QT_POINTER_SIZE == 8
+  static constexpr fx_int MAX_VALUE = 0x1fffffffffffffff;
+  static constexpr fx_int MIN_VALUE = -0x2000000000000000;
+#else
+  static constexpr fx_int MAX_VALUE = 0x1fffffff;
+  static constexpr fx_int MIN_VALUE = -0x20000000;
+#endif
 
   KevesFixnum() = default;
   KevesFixnum(const KevesFixnum&) = default;
@@ -41,22 +46,32 @@ public:
   explicit constexpr KevesFixnum(qint32 i) : val_(i) {
   }
 
+#if QT_POINTER_SIZE == 8
+  explicit constexpr KevesFixnum(fx_int i) : val_(i) {
+  }
+#endif
+
+  // fx_long is long long, another type than fx_int, which is long on LP64
+  // and int elsewhere. The value must be checked by isInRange().
+  explicit constexpr KevesFixnum(fx_long i) : val_(static_cast<fx_int>(i)) {
+  }
+
   explicit constexpr KevesFixnum(double d) : val_(d) {
   }
 
   explicit KevesFixnum(KevesValue qev)
-    : val_(qev.toUIntPtr() >> 2) {
+    : val_(static_cast<fx_int>(qev.toUIntPtr()) >> 2) {
     Q_ASSERT(qev.isFixnum());
   }
   
   template<typename Other> explicit KevesFixnum(Other) = delete;
 
-  operator qint32() const {
+  operator fx_int() const {
     return val_;
   }
 
   operator KevesValue() const {
-    return KevesValue(reinterpret_cast<Kev*>(val_ << 2 | 3));
+    return KevesValue(reinterpret_cast<Kev*>(static_cast<quintptr>(val_) << 2 | 3));
   }
 
   bool isNegative() const {
@@ -93,12 +108,12 @@ public:
     return temp;
   }
 
-  KevesFixnum& operator+=(qint32 addend)  {
+  KevesFixnum& operator+=(fx_int addend)  {
     val_ += addend;
     return *this;
   }
 
-  KevesFixnum& operator-=(qint32 subtrahend)  {
+  KevesFixnum& operator-=(fx_int subtrahend)  {
     val_ -= subtrahend;
     return *this;
   }
@@ -127,10 +142,15 @@ public:
     return lhs.val_ <= rhs.val_;
   }
 
-  static bool isInRange(qint32 i) {
+  static bool isInRange(fx_long i) {
     return i <= MAX_VALUE && i >= MIN_VALUE;
   }
 
+  // Return false when the product does not fit in fx_long.
+  static bool multiply(fx_long num1, fx_long num2, fx_long* product) {
+    return !__builtin_mul_overflow(num1, num2, product);
+  }
+
 private:
   fx_int val_ = 0;
 };
@@ -0,0 +1,116 @@
+// keves/value/flonum.hpp - immediate flonum for Keves
+// Keves will be an R6RS Scheme implementation.
+//
+// Copyright (C) 2014  Yasuhiro Yamakawa <kawatab@yahoo.co.jp>
+//
+//  This program is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or any
+//  later version.
+//
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+//  License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstring>
+#include "keves_value.hpp"
+
+
+/* ----------------------------------------
+ * A double is embedded in a KevesValue on 64-bit targets when its exponent
+ * is in [2^-63, 2^64], or when it is zero. Others are boxed in FlonumKev.
+ *
+ * |EEEEEEEM|MMMMMMMM|...|MMMMMMMM|MMMMMMMS|0001|
+ * E: 7 bits of the exponent, biased by EXPONENT_OFFSET
+ * M: 52 bits of the significand
+ * S: a sign bit
+ * Both E and M are 0 for zero, so 2^-63 itself is boxed.
+ * ----------------------------------------
+ */
+
+class KevesFlonum {
+public:
+  KevesFlonum() = delete;
+  KevesFlonum(const KevesFlonum&) = default;
+  KevesFlonum(KevesFlonum&&) = default;
+  KevesFlonum& operator=(const KevesFlonum&) = default;
+  KevesFlonum& operator=(KevesFlonum&&) = delete;
+  ~KevesFlonum() = default;
+
+  explicit KevesFlonum(double d) : val_(d) {
+    Q_ASSERT(isEncodable(d));
+  }
+
+  explicit KevesFlonum(KevesValue qev) : val_(decode(qev.toUIntPtr())) {
+    Q_ASSERT(qev.isFlonum());
+  }
+
+  template<typename Other> explicit KevesFlonum(Other) = delete;
+
+  operator double() const {
+    return val_;
+  }
+
+  operator KevesValue() const {
+    return KevesValue(reinterpret_cast<Kev*>(encode(val_)));
+  }
+
+  static bool isEncodable(double d) {
+#if QT_POINTER_SIZE == 8
+    quint64 bits(toBits(d));
+    quint64 exponent((bits >> 52 & 0x7ff) - EXPONENT_OFFSET);
+    return (bits << 1) == 0 || (exponent < 0x80 && (exponent | (bits << 12)));
+#else
+    Q_UNUSED(d);
+    return false;
+#endif
+  }
+
+private:
+  static constexpr quint64 EXPONENT_OFFSET = 1023 - 63;
+
+  static quint64 toBits(double d) {
+    quint64 bits;
+    std::memcpy(&bits, &d, sizeof(bits));
+    return bits;
+  }
+
+  static double fromBits(quint64 bits) {
+    double d;
+    std::memcpy(&d, &bits, sizeof(d));
+    return d;
+  }
+
+  static quintptr encode(double d) {
+    quint64 bits(toBits(d));
+    quint64 sign(bits >> 63);
+
+    if ((bits << 1) == 0)
+      return static_cast<quintptr>(sign << 4 | 1);
+
+    quint64 exponent((bits >> 52 & 0x7ff) - EXPONENT_OFFSET);
+    quint64 significand(bits & 0xfffffffffffff);
+    return static_cast<quintptr>((exponent << 53 | significand << 1 | sign) << 4 | 1);
+  }
+
+  static double decode(quintptr val) {
+    quint64 payload(static_cast<quint64>(val) >> 4);
+    quint64 sign(payload & 1);
+
+    if ((payload >> 1) == 0)
+      return fromBits(sign << 63);
+
+    quint64 exponent((payload >> 53) + EXPONENT_OFFSET);
+    quint64 significand(payload >> 1 & 0xfffffffffffff);
+    return fromBits(sign << 63 | exponent << 52 | significand);
+  }
+
+  double val_;
+};
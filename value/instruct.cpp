@@ -41,10 +41,15 @@ KevesInstructTable::KevesInstructTable() {
   SET_NAME_TO_TABLE(SWITCH_N_ARG_R);
   SET_NAME_TO_TABLE(FRAME);
   SET_NAME_TO_TABLE(FRAME_R);
+  SET_NAME_TO_TABLE(FRAME_N_R);
   SET_NAME_TO_TABLE(SFRAME);
   SET_NAME_TO_TABLE(APPLY);
   SET_NAME_TO_TABLE(APPLY_CONSTANT);
   SET_NAME_TO_TABLE(APPLY_MULT);
+  SET_NAME_TO_TABLE(TAIL_APPLY);
+  SET_NAME_TO_TABLE(TAIL_APPLY_CONSTANT);
+  SET_NAME_TO_TABLE(APPLY_LAMBDA);
+  SET_NAME_TO_TABLE(TAIL_APPLY_LAMBDA);
   SET_NAME_TO_TABLE(RETURN);
   SET_NAME_TO_TABLE(RETURN_CONSTANT);
   SET_NAME_TO_TABLE(RETURN0);
@@ -90,6 +95,17 @@ KevesInstructTable::KevesInstructTable() {
 
   SET_NAME_TO_TABLE(TEST_NUMBER_EQUAL_R);
 
+  // for fixnums
+  SET_NAME_TO_TABLE(ADD_FX);
+  SET_NAME_TO_TABLE(SUB_FX);
+  SET_NAME_TO_TABLE(LT_FX_R);
+  SET_NAME_TO_TABLE(NUM_EQ_FX_R);
+  SET_NAME_TO_TABLE(ADD_FX_LOCAL);
+  SET_NAME_TO_TABLE(SUB_FX_LOCAL);
+  SET_NAME_TO_TABLE(LT_FX_LOCAL_R);
+  SET_NAME_TO_TABLE(NUM_EQ_FX_LOCAL_R);
+  CHECK_SUM(NUM_EQ_FX_LOCAL_R);
+
   // for char
   SET_NAME_TO_TABLE(TEST_CHAR_R);
   SET_NAME_TO_TABLE(TEST_CHAR0_R);
@@ -122,7 +138,7 @@ KevesInstructTable::KevesInstructTable() {
 
   // for call/cc
   SET_NAME_TO_TABLE(UNWIND_CONTINUATION);
-  SET_NAME_TO_TABLE(REVERT_DYNAMIC_WIND);
+  SET_NAME_TO_TABLE(EXPIRE_ESCAPE);
 
   // for dynamic-wind
   SET_NAME_TO_TABLE(SET_DYNAMIC_WIND);
@@ -37,10 +37,15 @@ enum keves_instruct {
   CMD_SWITCH_N_ARG_R,
   CMD_FRAME,
   CMD_FRAME_R,
+  CMD_FRAME_N_R,
   CMD_SFRAME,
   CMD_APPLY,
   CMD_APPLY_CONSTANT,
   CMD_APPLY_MULT,
+  CMD_TAIL_APPLY,
+  CMD_TAIL_APPLY_CONSTANT,
+  CMD_APPLY_LAMBDA,
+  CMD_TAIL_APPLY_LAMBDA,
   CMD_RETURN,
   CMD_RETURN_CONSTANT,
   CMD_RETURN0,
@@ -84,6 +89,16 @@ enum keves_instruct {
 
   CMD_TEST_NUMBER_EQUAL_R,
 
+  // for fixnums
+  CMD_ADD_FX,
+  CMD_SUB_FX,
+  CMD_LT_FX_R,
+  CMD_NUM_EQ_FX_R,
+  CMD_ADD_FX_LOCAL,
+  CMD_SUB_FX_LOCAL,
+  CMD_LT_FX_LOCAL_R,
+  CMD_NUM_EQ_FX_LOCAL_R,
+
   // for char
   CMD_TEST_CHAR_R,
   CMD_TEST_CHAR0_R,
@@ -115,7 +130,7 @@ enum keves_instruct {
 
   // for call/cc
   CMD_UNWIND_CONTINUATION,
-  CMD_REVERT_DYNAMIC_WIND,
+  CMD_EXPIRE_ESCAPE,
 
   // for dynamic-wind
   CMD_SET_DYNAMIC_WIND,